@@ -10,6 +10,7 @@
 #include <string>
 
 struct field;
+struct submap;
 class item;
 class player;
 class vehicle;
@@ -92,6 +93,36 @@ inline GPS_loc operator+(const std::variant<point, tripoint>& lhs, GPS_loc rhs)
 	return rhs += std::get<tripoint>(lhs);
 }
 
+// Area scans around a fixed origin (in map.cpp).  Submaps are resolved once per chunk crossed rather than once per tile:
+// the origin's 3x3 neighborhood is cached, farther chunks go through map::chunk as GPS_loc does.
+// Not valid across anything that creates, loads or discards submaps (reality bubble shift, mapgen).
+class GPS_cursor
+{
+public:
+	explicit GPS_cursor(const GPS_loc& origin) noexcept;
+	GPS_cursor(const GPS_cursor& src) = default;
+	~GPS_cursor() = default;
+	GPS_cursor& operator=(const GPS_cursor& src) = default;
+
+	const GPS_loc& seek(const point& delta);	// reposition at origin + delta
+	const GPS_loc& loc() const { return _loc; }
+	submap* chunk() const { return _sm; }	// nullptr if not generated yet
+
+	ter_id ter() const;
+	field& field_at();
+	std::vector<item>& items_at();
+	bool is_outside();	// as GPS_loc::is_outside
+
+private:
+	GPS_loc _origin;
+	GPS_loc _loc;
+	submap* _sm;
+	submap* _near[3][3];
+	unsigned short _known;	// bitmap over _near
+
+	submap* _resolve(const tripoint& gps);
+};
+
 // following in line.cpp
 std::vector<GPS_loc> continue_line(const std::vector<GPS_loc>& line, int distance);
 
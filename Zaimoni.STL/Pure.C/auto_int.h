@@ -0,0 +1,20 @@
+/* auto_int.h */
+#ifndef AUTO_INT_H
+#define AUTO_INT_H 1
+
+/* base 2 logarithm of x; pretend 0 is 1 */
+#define INT_LOG2(x) ((x)>=(1ULL<<63) ? 63: (x)>=(1ULL<<62) ? 62: (x)>=(1ULL<<61) ? 61: (x)>=(1ULL<<60) ? 60: (x)>=(1ULL<<59) ? 59: (x)>=(1ULL<<58) ? 58: (x)>=(1ULL<<57) ? 57: (x)>=(1ULL<<56) ? 56: (x)>=(1ULL<<55) ? 55: (x)>=(1ULL<<54) ? 54: (x)>=(1ULL<<53) ? 53: (x)>=(1ULL<<52) ? 52: (x)>=(1ULL<<51) ? 51: (x)>=(1ULL<<50) ? 50: (x)>=(1ULL<<49) ? 49: (x)>=(1ULL<<48) ? 48: (x)>=(1ULL<<47) ? 47: (x)>=(1ULL<<46) ? 46: (x)>=(1ULL<<45) ? 45: (x)>=(1ULL<<44) ? 44: (x)>=(1ULL<<43) ? 43: (x)>=(1ULL<<42) ? 42: (x)>=(1ULL<<41) ? 41: (x)>=(1ULL<<40) ? 40: (x)>=(1ULL<<39) ? 39: (x)>=(1ULL<<38) ? 38: (x)>=(1ULL<<37) ? 37: (x)>=(1ULL<<36) ? 36: (x)>=(1ULL<<35) ? 35: (x)>=(1ULL<<34) ? 34: (x)>=(1ULL<<33) ? 33: (x)>=(1ULL<<32) ? 32: (x)>=(1ULL<<31) ? 31: (x)>=(1ULL<<30) ? 30: (x)>=(1ULL<<29) ? 29: (x)>=(1ULL<<28) ? 28: (x)>=(1ULL<<27) ? 27: (x)>=(1ULL<<26) ? 26: (x)>=(1ULL<<25) ? 25: (x)>=(1ULL<<24) ? 24: (x)>=(1ULL<<23) ? 23: (x)>=(1ULL<<22) ? 22: (x)>=(1ULL<<21) ? 21: (x)>=(1ULL<<20) ? 20: (x)>=(1ULL<<19) ? 19: (x)>=(1ULL<<18) ? 18: (x)>=(1ULL<<17) ? 17: (x)>=(1ULL<<16) ? 16: (x)>=(1ULL<<15) ? 15: (x)>=(1ULL<<14) ? 14: (x)>=(1ULL<<13) ? 13: (x)>=(1ULL<<12) ? 12: (x)>=(1ULL<<11) ? 11: (x)>=(1ULL<<10) ? 10: (x)>=(1ULL<<9) ? 9: (x)>=(1ULL<<8) ? 8: (x)>=(1ULL<<7) ? 7: (x)>=(1ULL<<6) ? 6: (x)>=(1ULL<<5) ? 5: (x)>=(1ULL<<4) ? 4: (x)>=(1ULL<<3) ? 3: (x)>=(1ULL<<2) ? 2: (x)>=(1ULL<<1) ? 1: 0)
+#define ULONG_LOG2(x) ((x)>=(1UL<<63) ? 63: (x)>=(1UL<<62) ? 62: (x)>=(1UL<<61) ? 61: (x)>=(1UL<<60) ? 60: (x)>=(1UL<<59) ? 59: (x)>=(1UL<<58) ? 58: (x)>=(1UL<<57) ? 57: (x)>=(1UL<<56) ? 56: (x)>=(1UL<<55) ? 55: (x)>=(1UL<<54) ? 54: (x)>=(1UL<<53) ? 53: (x)>=(1UL<<52) ? 52: (x)>=(1UL<<51) ? 51: (x)>=(1UL<<50) ? 50: (x)>=(1UL<<49) ? 49: (x)>=(1UL<<48) ? 48: (x)>=(1UL<<47) ? 47: (x)>=(1UL<<46) ? 46: (x)>=(1UL<<45) ? 45: (x)>=(1UL<<44) ? 44: (x)>=(1UL<<43) ? 43: (x)>=(1UL<<42) ? 42: (x)>=(1UL<<41) ? 41: (x)>=(1UL<<40) ? 40: (x)>=(1UL<<39) ? 39: (x)>=(1UL<<38) ? 38: (x)>=(1UL<<37) ? 37: (x)>=(1UL<<36) ? 36: (x)>=(1UL<<35) ? 35: (x)>=(1UL<<34) ? 34: (x)>=(1UL<<33) ? 33: (x)>=(1UL<<32) ? 32: (x)>=(1UL<<31) ? 31: (x)>=(1UL<<30) ? 30: (x)>=(1UL<<29) ? 29: (x)>=(1UL<<28) ? 28: (x)>=(1UL<<27) ? 27: (x)>=(1UL<<26) ? 26: (x)>=(1UL<<25) ? 25: (x)>=(1UL<<24) ? 24: (x)>=(1UL<<23) ? 23: (x)>=(1UL<<22) ? 22: (x)>=(1UL<<21) ? 21: (x)>=(1UL<<20) ? 20: (x)>=(1UL<<19) ? 19: (x)>=(1UL<<18) ? 18: (x)>=(1UL<<17) ? 17: (x)>=(1UL<<16) ? 16: (x)>=(1UL<<15) ? 15: (x)>=(1UL<<14) ? 14: (x)>=(1UL<<13) ? 13: (x)>=(1UL<<12) ? 12: (x)>=(1UL<<11) ? 11: (x)>=(1UL<<10) ? 10: (x)>=(1UL<<9) ? 9: (x)>=(1UL<<8) ? 8: (x)>=(1UL<<7) ? 7: (x)>=(1UL<<6) ? 6: (x)>=(1UL<<5) ? 5: (x)>=(1UL<<4) ? 4: (x)>=(1UL<<3) ? 3: (x)>=(1UL<<2) ? 2: (x)>=(1UL<<1) ? 1: 0)
+#define USHRT_LOG2(x) ((x)>=(1U<<15) ? 15: (x)>=(1U<<14) ? 14: (x)>=(1U<<13) ? 13: (x)>=(1U<<12) ? 12: (x)>=(1U<<11) ? 11: (x)>=(1U<<10) ? 10: (x)>=(1U<<9) ? 9: (x)>=(1U<<8) ? 8: (x)>=(1U<<7) ? 7: (x)>=(1U<<6) ? 6: (x)>=(1U<<5) ? 5: (x)>=(1U<<4) ? 4: (x)>=(1U<<3) ? 3: (x)>=(1U<<2) ? 2: (x)>=(1U<<1) ? 1: 0)
+#define UCHAR_LOG2(x) ((x)>=(1U<<7) ? 7: (x)>=(1U<<6) ? 6: (x)>=(1U<<5) ? 5: (x)>=(1U<<4) ? 4: (x)>=(1U<<3) ? 3: (x)>=(1U<<2) ? 2: (x)>=(1U<<1) ? 1: 0)
+
+#define ZAIMONI_SIZEOF_SHRT 2
+#define ZAIMONI_SIZEOF_INT 4
+#define ZAIMONI_SIZEOF_LONG 8
+#define ZAIMONI_SIZEOF_LLONG 8
+#define ZAIMONI_SIZEOF_CHARPTR 8
+#define ZAIMONI_SIZEOF_FUNCPTR 8
+#define ZAIMONI_NULL_REALLY_IS_ZERO 1
+#define ZAIMONI_LITTLE_ENDIAN 1
+
+#endif
@@ -0,0 +1,52 @@
+#include "animation.hpp"
+#include "map.h"
+#include "line.h"
+#include "options.h"
+#include "output.h"
+#include "recent_msg.h"
+#include "ui.h"
+
+animation& animation::get()
+{
+	static animation ooao;
+	return ooao;
+}
+
+bool animation::enabled() { return !option_table::get()[OPT_NO_ANIMATION]; }
+
+void animation::add(std::vector<glyph>&& draw, long delay, std::vector<GPS_loc>&& restore)
+{
+	if (!enabled()) return;
+	frames.push_back(frame{ std::move(restore), std::move(draw), delay, int(messages.turn) });
+}
+
+bool animation::play(WINDOW* w, const player& u)
+{
+	if (frames.empty()) return false;
+	const int now = int(messages.turn);
+	bool drawn = false;
+	for (const auto& f : frames) {
+		if (f.turn + 1 < now) continue;	// stale: queued while the screen was not being drawn (sleep, activities)
+		for (decltype(auto) loc : f.restore) map::drawsq(w, u, loc, false, true);
+		for (decltype(auto) g : f.draw) {
+			const auto delta = g.pos - u.GPSpos;
+			const auto pt = std::get_if<point>(&delta);
+			if (!pt || VIEW_CENTER < Linf_dist(*pt)) continue;	// off screen
+			mvwputch(w, pt->y + VIEW_CENTER, pt->x + VIEW_CENTER, g.col, g.sym);
+		}
+		wrefresh(w);
+		drawn = true;
+		// wait for input rather than sleeping, so a keypress skips the rest
+		const int ms = f.delay / 1000000;
+		if (0 >= ms) continue;
+		timeout(ms);
+		const int ch = getch();
+		timeout(-1);
+		if (ERR != ch) {
+			ungetch(ch);
+			break;
+		}
+	}
+	frames.clear();
+	return drawn;
+}
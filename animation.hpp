@@ -0,0 +1,48 @@
+#ifndef ANIMATION_HPP
+#define ANIMATION_HPP 1
+
+#include "GPS_loc.hpp"
+#include "color.h"
+#include <vector>
+
+class player;
+
+// singleton
+// Effects queue their frames here rather than sleeping between damage applications.  game::draw plays them back
+// after the simulation step; playback is cut short by a keypress, and is off entirely with OPT_NO_ANIMATION.
+class animation
+{
+public:
+	struct glyph {
+		GPS_loc pos;	// converted to w_terrain coordinates at playback, as the view may have moved since
+		nc_color col;
+		long sym;
+
+		glyph(const GPS_loc& pos, nc_color col, long sym) noexcept : pos(pos), col(col), sym(sym) {}
+	};
+
+private:
+	struct frame {
+		std::vector<GPS_loc> restore;	// redrawn from the map first
+		std::vector<glyph> draw;
+		long delay;	// nanoseconds
+		int turn;
+	};
+
+	std::vector<frame> frames;
+
+	animation() = default;
+	~animation() = default;
+	animation(const animation& src) = delete;
+	animation(animation&& src) = delete;
+	animation& operator=(const animation& src) = delete;
+	animation& operator=(animation&& src) = delete;
+public:
+	static animation& get();
+	static bool enabled();
+
+	void add(std::vector<glyph>&& draw, long delay, std::vector<GPS_loc>&& restore = std::vector<GPS_loc>());
+	bool play(WINDOW* w, const player& u);	// true if anything was drawn
+};
+
+#endif
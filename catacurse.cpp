@@ -1458,8 +1458,22 @@ int refresh(void)
 
 //Not terribly sure how this function is suppose to work,
 //but jday helped to figure most of it out
+static int pushed_back = ERR;	// ungetch
+
+int ungetch(int ch)
+{
+    if (ERR != pushed_back) return ERR;
+    pushed_back = ch;
+    return OK;
+}
+
 int getch(void)
 {
+ if (ERR != pushed_back) {
+     const int ret = pushed_back;
+     pushed_back = ERR;
+     return ret;
+ }
  refresh();
  InvalidateRect(win(),nullptr,true);
  lastchar=ERR;//ERR=-1
@@ -80,6 +80,7 @@ int wborder(WINDOW *win, chtype ls, chtype rs, chtype ts, chtype bs, chtype tl,
 int wrefresh(WINDOW *win);
 int refresh(void);
 int getch(void);
+int ungetch(int ch);
 int mvwprintw(WINDOW *win, int y, int x, const char *fmt, ...);
 int mvprintw(int y, int x, const char *fmt, ...);
 int werase(WINDOW *win);
@@ -7,8 +7,15 @@
 #include "json.h"
 
 #include <stdexcept>
+#include <algorithm>
+#include <string.h>
 
-std::vector<event> event::_events;
+std::vector<event> event::_pending;
+std::vector<event> event::_active;
+int event::_count[NUM_EVENT_TYPES] = {};
+
+// heap order for _pending: earliest turn on top
+static bool fires_after(const event& lhs, const event& rhs) { return lhs.turn > rhs.turn; }
 
 static const char* const JSON_transcode_events[] = {
     "HELP",
@@ -69,38 +76,86 @@ bool fromJSON(const cataclysm::JSON& src, event& dest)
 
 const event* event::queued(event_type type)
 {
-    for (decltype(auto) ev : _events) if (type == ev.type) return &ev;
+    if (0 >= _count[type]) return nullptr;
+    if (has_per_turn(type)) {
+        for (decltype(auto) ev : _active) if (type == ev.type) return &ev;
+    } else {
+        for (decltype(auto) ev : _pending) if (type == ev.type) return &ev;
+    }
     return nullptr;
 }
 
-void event::global_reset(const Badge<game>& badge) { _events.clear(); }
+void event::add(event&& src)
+{
+    _count[src.type]++;
+    if (has_per_turn(src.type)) {
+        _active.push_back(std::move(src));
+        return;
+    }
+    _pending.push_back(std::move(src));
+    std::push_heap(_pending.begin(), _pending.end(), fires_after);
+}
+
+void event::_erase_active(int i)
+{
+    _count[_active[i].type]--;
+    EraseAt(_active, i);
+}
+
+void event::global_reset(const Badge<game>& badge) { _clear(); }
+
+void event::_clear()
+{
+    _pending.clear();
+    _active.clear();
+    memset(_count, 0, sizeof(_count));
+}
 
 void event::global_fromJSON(const cataclysm::JSON& src)
 {
-    _events.clear();
-    if (src.has_key("events")) src["events"].decode(_events);
+    _clear();
+    if (src.has_key("events")) {
+        std::vector<event> staging;
+        src["events"].decode(staging);
+        for (decltype(auto) ev : staging) add(std::move(ev));
+    }
 }
 
 void event::global_toJSON(cataclysm::JSON& dest)
 {
-    if (!_events.empty()) dest.set("events", cataclysm::JSON::encode(_events));
+    if (_pending.empty() && _active.empty()) return;
+    std::vector<event> staging(_active);
+    staging.insert(staging.end(), _pending.begin(), _pending.end());
+    dest.set("events", cataclysm::JSON::encode(staging));
 }
 
 void event::process(const Badge<game>& badge)
 {
+    const int now = int(messages.turn);
+
     // We want to go forward, to allow for the possibility of events scheduling events for same-turn
-    for (int i = 0; i < _events.size(); i++) {
-        decltype(auto) e = _events[i];
+    for (int i = 0; i < _active.size(); i++) {
+        decltype(auto) e = _active[i];
         if (!e.per_turn()) {
-            EraseAt(_events, i--);
+            _erase_active(i--);
             continue;
         }
-        if (e.turn <= int(messages.turn)) {
-            e.actualize();
-            EraseAt(_events, i--);
+        if (e.turn <= now) {
+            const event fire(e);
+            _erase_active(i--);
+            fire.actualize();
             continue;
         }
     }
+
+    // remaining events do nothing until their turn comes up; same-turn events they schedule are picked up by this loop
+    while (!_pending.empty() && _pending.front().turn <= now) {
+        std::pop_heap(_pending.begin(), _pending.end(), fires_after);
+        const event fire(std::move(_pending.back()));
+        _pending.pop_back();
+        _count[fire.type]--;
+        fire.actualize();
+    }
 }
 
 void event::actualize() const
@@ -292,7 +347,7 @@ void event::actualize() const
 // formerly map::random_outdoor_tile
 static std::optional<GPS_loc> random_outdoor_tile(GPS_loc loc)
 {
-    static std::function<std::optional<GPS_loc>(point)> ok = [&](point delta) {
+    auto ok = [&](point delta) -> std::optional<GPS_loc> {
         auto test = loc + delta;
         if (test.is_outside()) return std::optional(test);
         return std::optional<decltype(test)>();
@@ -28,7 +28,15 @@ enum event_type {
 DECLARE_JSON_ENUM_SUPPORT(event_type)
 
 class event {
-	static std::vector<event> _events;
+	static std::vector<event> _pending;	// min-heap on turn; events with no per-turn behavior
+	static std::vector<event> _active;	// events whose per_turn() must run every turn
+	static int _count[NUM_EVENT_TYPES];
+
+	static constexpr bool has_per_turn(event_type type) {
+		return EVENT_WANTED == type || EVENT_SPAWN_WYRMS == type || EVENT_AMIGARA == type || EVENT_TEMPLE_OPEN == type;
+	}
+	static void _erase_active(int i);
+	static void _clear();
 
 public:
  event_type type;
@@ -43,10 +51,10 @@ public:
  void actualize() const; // When the time runs out
  bool per_turn();  // Every turn.  Return false to request self-deletion i.e. no longer relevant
 
- static int are_queued() { return _events.size(); }
+ static int are_queued() { return _pending.size() + _active.size(); }
  static const event* queued(event_type type);
- static void add(const event& src) { _events.push_back(src); }
- static void add(event&& src) { _events.push_back(std::move(src)); }
+ static void add(const event& src) { add(event(src)); }
+ static void add(event&& src);
  static void process(const Badge<game>& badge);
 
  // save/load support
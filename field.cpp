@@ -233,8 +233,9 @@ bool submap::process_fields()
                 // If the flames are REALLY big, they contribute to adjacent flames
                 if (3 == cur.density && 0 > cur.age) {
                     inline_stack<field*, std::end(Direction::vector) - std::begin(Direction::vector)> stage;
+                    GPS_cursor dest(loc);
                     for (decltype(auto) dir : Direction::vector) {
-                        auto dest = loc + dir;
+                        dest.seek(dir);
                         auto& fd = dest.field_at();
                         if (fd_fire == fd.type && 3 > fd.density && (!in_pit || t_pit == dest.ter())) stage.push(&fd);
                     }
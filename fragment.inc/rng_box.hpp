@@ -13,6 +13,7 @@
 #endif
 
 #include <optional>
+#include <type_traits>
 #include <vector>
 
 template <int radius>
@@ -28,7 +29,11 @@ inline point rng(const zaimoni::gdi::box<point>& src) { return point(rng(src.tl_
 // Technically, following should be in a header for enums.h and Zaimoni.STL/GDI/box.hpp only, but our inclusion point is effectively "early" (map.h).
 // box.hpp is providing #include <functional>.
 
-inline void forall_do(const zaimoni::gdi::box<point>& src, std::function<void(point)> op) { // for API completeness
+// These take the callable by template parameter rather than std::function, so the per-tile body can be inlined into the loop.
+// Where one name covers several behaviors, the callable's return type selects among them.
+
+template<class F>
+void forall_do(const zaimoni::gdi::box<point>& src, F&& op) { // for API completeness
 	const point anchor = src.tl_c();
 	const point strict_ub = src.br_c();
 	point pt;
@@ -39,83 +44,71 @@ inline void forall_do(const zaimoni::gdi::box<point>& src, std::function<void(po
 	}
 }
 
-inline void forall_do_inclusive(const zaimoni::gdi::box<point>& src, std::function<void(point)> op) {
+// bool-valued op: true if op returned true anywhere (all tiles are still visited)
+template<class F>
+auto forall_do_inclusive(const zaimoni::gdi::box<point>& src, F&& op) {
 	// this will need revision if we want to actually use INT_MAX upper bound
 	const point anchor = src.tl_c();
 	const point nonstrict_ub = src.br_c();
 	point pt;
-	for (pt.x = anchor.x; pt.x <= nonstrict_ub.x; ++pt.x) {
-		for (pt.y = anchor.y; pt.y <= nonstrict_ub.y; ++pt.y) {
-			op(pt);
+	if constexpr (std::is_same_v<bool, std::invoke_result_t<F&, point> >) {
+		bool ret = false;
+		for (pt.x = anchor.x; pt.x <= nonstrict_ub.x; ++pt.x) {
+			for (pt.y = anchor.y; pt.y <= nonstrict_ub.y; ++pt.y) {
+				if (op(pt)) ret = true;
+			}
 		}
-	}
-}
-
-inline bool forall_do_inclusive(const zaimoni::gdi::box<point>& src, std::function<bool(point)> op) {
-	// this will need revision if we want to actually use INT_MAX upper bound
-	bool ret = false;
-	const point anchor = src.tl_c();
-	const point nonstrict_ub = src.br_c();
-	point pt;
-	for (pt.x = anchor.x; pt.x <= nonstrict_ub.x; ++pt.x) {
-		for (pt.y = anchor.y; pt.y <= nonstrict_ub.y; ++pt.y) {
-			if (op(pt)) ret = true;
-		}
-	}
-	return ret;
-}
-
-inline std::optional<point> find_first(const zaimoni::gdi::box<point>& src, std::function<bool(point)> test) {
-	// this will need revision if we want to actually use INT_MAX upper bound
-	const point anchor = src.tl_c();
-	const point nonstrict_ub = src.br_c();
-	point pt;
-	for (pt.x = anchor.x; pt.x <= nonstrict_ub.x; ++pt.x) {
-		for (pt.y = anchor.y; pt.y <= nonstrict_ub.y; ++pt.y) {
-			if (test(pt)) return pt;
+		return ret;
+	} else {
+		for (pt.x = anchor.x; pt.x <= nonstrict_ub.x; ++pt.x) {
+			for (pt.y = anchor.y; pt.y <= nonstrict_ub.y; ++pt.y) {
+				op(pt);
+			}
 		}
 	}
-	return std::nullopt;
 }
 
-template<class T>
-std::optional<T> find_first(const zaimoni::gdi::box<point>& src, std::function<std::optional<T>(point)> test) {
+// bool-valued test: first point passing it; std::optional<T>-valued test: its first non-empty result
+template<class F>
+auto find_first(const zaimoni::gdi::box<point>& src, F&& test) {
 	// this will need revision if we want to actually use INT_MAX upper bound
+	using result_t = std::invoke_result_t<F&, point>;
+	using ret_t = std::conditional_t<std::is_same_v<bool, result_t>, std::optional<point>, result_t>;
 	const point anchor = src.tl_c();
 	const point nonstrict_ub = src.br_c();
 	point pt;
 	for (pt.x = anchor.x; pt.x <= nonstrict_ub.x; ++pt.x) {
 		for (pt.y = anchor.y; pt.y <= nonstrict_ub.y; ++pt.y) {
-			if (auto ok = test(pt)) return ok;
+			if constexpr (std::is_same_v<bool, result_t>) {
+				if (test(pt)) return ret_t(pt);
+			} else {
+				if (auto ok = test(pt)) return ok;
+			}
 		}
 	}
-	return std::nullopt;
+	return ret_t();
 }
 
-inline std::vector<point> grep(const zaimoni::gdi::box<point>& src, std::function<bool(point)> ok) { // Cf. Perl, or *NIX command line utility grep
-	// this will need revision if we want to actually use INT_MAX upper bound
-	std::vector<point> ret;
-	const point anchor = src.tl_c();
-	const point nonstrict_ub = src.br_c();
-	point pt;
-	for (pt.x = anchor.x; pt.x <= nonstrict_ub.x; ++pt.x) {
-		for (pt.y = anchor.y; pt.y <= nonstrict_ub.y; ++pt.y) {
-			if (ok(pt)) ret.push_back(pt);
-		}
-	}
-	return ret;
-}
+template<class R> struct _grep_value { using type = typename R::value_type; };	// R is std::optional<T>
+template<> struct _grep_value<bool> { using type = point; };
 
-template<class T>
-std::vector<T> grep(const zaimoni::gdi::box<point>& src, std::function<std::optional<T>(point)> ok) { // Cf. Perl map; don't want to get confused with std::map
+// Cf. Perl, or *NIX command line utility grep: bool-valued ok collects the points passing it.
+// Cf. Perl map (don't want to get confused with std::map): std::optional<T>-valued ok collects the non-empty results.
+template<class F>
+auto grep(const zaimoni::gdi::box<point>& src, F&& ok) {
 	// this will need revision if we want to actually use INT_MAX upper bound
-	std::vector<T> ret;
+	using result_t = std::invoke_result_t<F&, point>;
+	std::vector<typename _grep_value<result_t>::type> ret;
 	const point anchor = src.tl_c();
 	const point nonstrict_ub = src.br_c();
 	point pt;
 	for (pt.x = anchor.x; pt.x <= nonstrict_ub.x; ++pt.x) {
 		for (pt.y = anchor.y; pt.y <= nonstrict_ub.y; ++pt.y) {
-			if (auto test = ok(pt)) ret.push_back(*test);
+			if constexpr (std::is_same_v<bool, result_t>) {
+				if (ok(pt)) ret.push_back(pt);
+			} else {
+				if (auto test = ok(pt)) ret.push_back(*test);
+			}
 		}
 	}
 	return ret;
@@ -11,16 +11,17 @@
 #include "options.h"
 #include "mapbuffer.h"
 #include "mondeath.h"
-#include "posix_time.h"
 #include "file.h"
 #include "recent_msg.h"
 #include "saveload.h"
 #include "json.h"
 #include "om_cache.hpp"
+#include "profile.hpp"
 #include "stl_limits.h"
 #include "stl_typetraits.h"
 #include "game_aux.hpp"
 #include "gui.hpp"
+#include "animation.hpp"
 
 #include <fstream>
 #include <sstream>
@@ -125,7 +126,7 @@ void game::setup()	// early part looks like it belongs in game::game (but we ret
  weather = WEATHER_CLEAR; // Start with some nice weather...
  nextweather = MINUTES(STARTING_MINUTES + 30); // Weather shift in 30
  
- z.clear();
+ z_clear();
  coming_to_stairs.clear();
  active_npc.clear();
  factions.clear();
@@ -594,8 +595,14 @@ bool game::do_turn()
 // Actual stuff
  gamemode->per_turn(this);
  messages.turn.increment();
+ {
+ PROFILE_SCOPE("events");
  event::process(Badge<game>());
+ }
+ {
+ PROFILE_SCOPE("missions");
  process_missions();
+ }
  if (messages.turn.hour == 0 && messages.turn.minute == 0 && messages.turn.second == 0) // Midnight!
   cur_om.process_mongroups();
 
@@ -643,10 +650,14 @@ bool game::do_turn()
   if (u.radiation > 1 && one_in(3)) u.radiation--;
   u.get_sick();
 // Auto-save on the half-hour
+  PROFILE_SCOPE("autosave");
   save();
  }
 // Update the weather, if it's time.
- if (messages.turn >= nextweather) update_weather();
+ if (messages.turn >= nextweather) {
+  PROFILE_SCOPE("weather update");
+  update_weather();
+ }
 
 // The following happens when we stay still; 10/40 minutes overdue for spawn
  if ((!u.has_trait(PF_INCONSPICUOUS) && messages.turn > nextspawn +  100) ||
@@ -655,12 +666,17 @@ bool game::do_turn()
   nextspawn = messages.turn;
  }
 
+ {
+ PROFILE_SCOPE("activity");
  process_activity();
+ }
 
  while (u.moves > 0) {
   cleanup_dead();
-  if (!u.has_disease(DI_SLEEP) && u.activity.type == ACT_NULL)
+  if (!u.has_disease(DI_SLEEP) && u.activity.type == ACT_NULL) {
+   PROFILE_SCOPE("draw");
    draw();
+  }
   get_input();
   if (is_game_over()) {
    if (uquit == QUIT_DIED) popup_top("Game over! Press spacebar...");
@@ -668,20 +684,46 @@ bool game::do_turn()
    return true;
   }
  }
+ {
+ PROFILE_SCOPE("scent");
  update_scent();
+ }
+ {
+ PROFILE_SCOPE("vehmove");
  m.vehmove(this);
+ }
+ {
+ PROFILE_SCOPE("fields");
  m.process_fields();
+ }
+ {
+ PROFILE_SCOPE("active items");
  m.process_active_items();
+ }
+ m.touch(int(messages.turn));
  m.step_in_field(this, u);
 
+ {
+ PROFILE_SCOPE("monmove");
  monmove();
+ }
+ {
+ PROFILE_SCOPE("stair monsters");
  update_stair_monsters();
+ }
+ {
+ PROFILE_SCOPE("NPCs");
  om_npcs_move();
+ }
+ {
+ PROFILE_SCOPE("player upkeep");
  u.reset(Badge<game>());
  u.process_active_items(this);
  u.suffer(this);
+ }
 
  if (lev.z >= 0) {
+  PROFILE_SCOPE("weather");
   (weather_datum::data[weather].effect)(this);
   u.check_warmth(temperature);
  }
@@ -691,8 +733,15 @@ bool game::do_turn()
   refresh();
  }
 
+ {
+ PROFILE_SCOPE("skills");
  u.update_skills();
- if (messages.turn % 10 == 0) u.update_morale();
+ }
+ if (messages.turn % 10 == 0) {
+  PROFILE_SCOPE("morale");
+  u.update_morale();
+ }
+ PROFILE_END_TURN(int(messages.turn));
  return false;
 }
 
@@ -1452,13 +1501,18 @@ void game::load(std::string name)
 	}
 
 	// monsters (allows validating last_target)
-	if (!saved["monsters"].decode(z) && z.empty()) throw corrupted+" 11";
+	{
+	std::vector<monster> tmp_z;
+	if (!saved["monsters"].decode(tmp_z) && tmp_z.empty()) throw corrupted+" 11";
+	z_clear();
+	for (decltype(auto) _mon : tmp_z) _z_index(z.insert(std::move(_mon)));
+	}
     // C:Z 0.3.1+: remove this backward-fit
     if (saved.has_key("last_target") && fromJSON(saved["last_target"], tmp)) u.set_target(tmp);
 
     static auto validate_target = [&](int src) {
         // \todo handle targeting NPCs
-        return 0 <= src && z.size() > src;
+        return 0 <= src && z.at(src);
     };
 
 	// recoverable hacked-missing fields below
@@ -1515,8 +1569,19 @@ void game::save()
  } while (++i < SEEX * MAPSIZE);
  saved.set("scents", std::move(tmp));
  }
- saved.set("monsters", JSON::encode(z));
+ {	// saved monsters are numbered densely; game::z itself stays put
+ std::vector<monster> tmp_z;
+ std::vector<size_t> renumber(z.ub(), z.ub());
+ tmp_z.reserve(z.size());
+ for (auto it = z.begin(); it != z.end(); ++it) {
+	 renumber[it.index()] = tmp_z.size();
+	 tmp_z.push_back(*it);
+ }
+ saved.set("monsters", JSON::encode(tmp_z));
+ const int live_target = u.renumber_target(renumber);
  saved.set("player", toJSON(u));
+ u.set_target(live_target);
+ }
  saved.set("turn", std::to_string(messages.turn));
 
  std::ofstream fout((playerfile_stem.str() + ".tmp").c_str());
@@ -1559,6 +1624,7 @@ void game::save()
  cur_om.save(u.name);
  //m.save(&cur_om, turn, levx, levy);
  MAPBUFFER.save();
+ recent_msg::flush_log();
 }
 
 void game::debug()
@@ -1578,7 +1644,8 @@ void game::debug()
                    "Learn all melee styles", // 12
                    "Check NPC",              // 13
                    "Spawn Artifact",         // 14
-                   "Cancel"});               // 15
+                   "Turn profile...",        // 15
+                   "Cancel"});               // 16
  std::vector<std::string> opts;
  switch (action) {
   case 1:
@@ -1591,7 +1658,7 @@ void game::debug()
 
   case 3: {
    if (const auto tmp = cur_om.choose_point(this)) {
-    z.clear();
+    z_clear();
     //m.save(&cur_om, turn, levx, levy);
     lev.x = tmp->x * 2 - int(MAPSIZE / 2);
     lev.y = tmp->y * 2 - int(MAPSIZE / 2);
@@ -1637,6 +1704,19 @@ oter_t::list[cur_om.ter(lev.x / 2, lev.y / 2)].name.c_str(),
 int(messages.turn), int(nextspawn), (option_table::get()[OPT_NPCS] ? "going to" : "NOT going to"),
 z.size(), event::are_queued());
 
+#if defined(PROFILE_TURNS)
+   if (const auto costs = mtype::special_attack_costs(); !costs.empty()) {
+    std::string msg("Special attack time this session:");
+    char buf[100];
+    for (size_t i = 0; i < costs.size() && i < 10; i++) {
+     snprintf(buf, sizeof(buf), "\n%s: %lu calls, %.3f ms", costs[i].first->name.c_str(), costs[i].second.calls,
+              std::chrono::duration<double, std::milli>(costs[i].second.elapsed).count());
+     msg += buf;
+    }
+    popup_top("%s", msg.c_str());
+   }
+#endif
+
    if (!active_npc.empty())
     popup_top("%s: %d:%d (you: %d:%d)", active_npc[0]->name.c_str(),
               active_npc[0]->pos.x, active_npc[0]->pos.y, u.pos.x, u.pos.y);
@@ -1717,6 +1797,42 @@ z.size(), event::are_queued());
        m.add_item(*center, new_natural_artifact(prop), 0);
    }
    break;
+
+  case 15:
+#if defined(PROFILE_TURNS)
+   {
+   auto& profile = turn_profile::get();
+   switch (menu("Turn profile", { "Show", "Write save/profile.json",
+                profile.tracing() ? "Stop trace to save/profile.csv" : "Start trace to save/profile.csv",
+                "Reset", "Cancel" })) {
+    case 1: {
+     std::ostringstream data;
+     data << profile.turns() << " turns profiled (ms; times are inclusive)" << std::endl;
+     char buf[120];
+     for (const auto& x : profile.report()) {
+      snprintf(buf, sizeof(buf), "%-20s %9lu calls %10.3f total %8.3f last turn %8.3f worst turn", x.name, x.calls,
+               std::chrono::duration<double, std::milli>(x.elapsed).count(),
+               std::chrono::duration<double, std::milli>(x.last_turn).count(),
+               std::chrono::duration<double, std::milli>(x.worst_turn).count());
+      data << buf << std::endl;
+     }
+     full_screen_popup(data.str().c_str());
+     } break;
+    case 2:
+     if (!profile.write_json()) popup("Can't write save/profile.json.");
+     break;
+    case 3:
+     if (!profile.trace(!profile.tracing())) popup("Can't open save/profile.csv.");
+     break;
+    case 4:
+     profile.reset();
+     break;
+   }
+   }
+#else
+   popup("Turn profiling was not built in (PROFILE_TURNS).");
+#endif
+   break;
  }
  erase();
  refresh_all();
@@ -1724,13 +1840,13 @@ z.size(), event::are_queued());
 
 void game::mondebug() const
 {
-    forall_do(std::function<void(const monster&)>([this](const monster& _mon) {
+    forall_do([this](const monster& _mon) {
         _mon.debug(u);
         if (_mon.has_flag(MF_SEES) && _mon.GPSpos.can_see(u.GPSpos, -1))
             debugmsg("The %s can see you.", _mon.name().c_str());
         else
             debugmsg("The %s can't see you...", _mon.name().c_str());
-    }));
+    });
 }
 
 void game::groupdebug()
@@ -1973,6 +2089,7 @@ void game::draw()
  // Draw map
  werase(w_terrain);
  draw_ter();
+ if (animation::get().play(w_terrain, u)) draw_ter();	// effects queued since the last draw, then clear the final frame
  u.draw_footsteps(w_terrain);
  mon_info();
  // Draw Status
@@ -2489,12 +2606,48 @@ void game::mon_info()
 
 void game::z_erase(std::function<bool(monster&)> reject)
 {
-    int i = z.size();
-    while (0 < --i) {
-        if (reject(z[i])) {
-            EraseAt(z, i);
-            u.target_dead(i);
-        }
+    z.erase_if([&](monster& _mon, size_t i) {
+        if (!reject(_mon)) return false;
+        u.target_dead(i);
+        const bool indexed = _z_unindex(i, _z_by_submap.find(_mon.GPSpos.first));
+        assert(indexed);    // every position change reaches z_moved through mobile::_moved
+        return true;
+    });
+}
+
+bool game::_z_unindex(size_t i, decltype(_z_by_submap)::iterator bucket)
+{
+    if (_z_by_submap.end() == bucket) return false;
+    auto& src = bucket->second;
+    const auto at = std::find(src.begin(), src.end(), i);
+    if (src.end() == at) return false;
+    *at = src.back();
+    src.pop_back();
+    if (src.empty()) _z_by_submap.erase(bucket);
+    return true;
+}
+
+void game::z_clear()
+{
+    z.clear();
+    _z_by_submap.clear();
+}
+
+void game::_z_index(size_t i)
+{
+    _z_by_submap[z[i].GPSpos.first].push_back(i);
+}
+
+void game::z_moved(const monster& whom, const tripoint& from)
+{
+    if (from == whom.GPSpos.first) return;
+    const auto bucket = _z_by_submap.find(from);
+    if (_z_by_submap.end() == bucket) return;
+    for (const size_t i : bucket->second) {
+        if (z.at(i) != &whom) continue;
+        _z_unindex(i, bucket);
+        _z_by_submap[whom.GPSpos.first].push_back(i);
+        return;
     }
 }
 
@@ -2775,17 +2928,92 @@ struct hit_by_shrapnel
     }
 };
 
+// Mobs within an explosion's reach, gathered once rather than scanned for per tile and per shrapnel step.
+// Entries are re-validated on use, and empty cells re-checked, as mobs can move, die or appear while the blast resolves.
+class blast_occupants
+{
+    using occupant = std::variant<size_t, std::shared_ptr<npc>, pc*>;  // size_t: index into game::z
+
+    game* const g;
+    const GPS_loc origin;
+    const int reach;
+    std::vector<occupant> mobs;
+    std::vector<int> cell;  // index into mobs, or -1
+
+    int span() const { return 2 * reach + 1; }
+    int cell_index(const GPS_loc& loc) const {
+        const auto delta = loc - origin;
+        const auto pt = std::get_if<point>(&delta);
+        if (!pt || reach < Linf_dist(*pt)) return -1;
+        return (pt->x + reach) + (pt->y + reach) * span();
+    }
+
+    void add(const GPS_loc& loc, occupant&& who) {
+        const int n = cell_index(loc);
+        if (0 > n || 0 <= cell[n]) return;  // first come; mob_at checks monsters, then NPCs, then the player
+        cell[n] = mobs.size();
+        mobs.push_back(std::move(who));
+    }
+
+public:
+    blast_occupants(const GPS_loc& origin, int reach) : g(game::active()), origin(origin), reach(reach), cell(span() * span(), -1) {
+        for (auto it = g->z.begin(); it != g->z.end(); ++it) {
+            if (!it->dead) add(it->GPSpos, it.index());
+        }
+        for (decltype(auto) _npc : g->active_npc) {
+            if (!_npc->dead) add(_npc->GPSpos, _npc);
+        }
+        add(g->u.GPSpos, &g->u);
+    }
+
+    blast_occupants(const blast_occupants& src) = delete;
+    blast_occupants(blast_occupants&& src) = delete;
+    blast_occupants& operator=(const blast_occupants& src) = delete;
+    blast_occupants& operator=(blast_occupants&& src) = delete;
+    ~blast_occupants() = default;
+
+    std::optional<std::variant<monster*, npc*, pc*> > at(const GPS_loc& loc) const {
+        const int n = cell_index(loc);
+        if (0 > n || 0 > cell[n]) return g->mob_at(loc);  // may have arrived since gathering: spawned, split, knocked back
+        decltype(auto) who = mobs[cell[n]];
+        if (const auto i = std::get_if<size_t>(&who)) {
+            if (auto _mon = g->z.at(*i); _mon && !_mon->dead && loc == _mon->GPSpos) return _mon;
+        } else if (const auto _npc = std::get_if<std::shared_ptr<npc> >(&who)) {
+            if (!(*_npc)->dead && loc == (*_npc)->GPSpos) return _npc->get();
+        } else if (loc == g->u.GPSpos) return &g->u;
+        return g->mob_at(loc);  // moved or died since gathering
+    }
+};
+
+void game::explosion_rings(const GPS_loc& epicenter, int radius)
+{
+ for (int i = 1; i <= radius; i++) {
+  std::vector<animation::glyph> ring;
+  ring.emplace_back(epicenter + point(-i, -i), c_red, '/');
+  ring.emplace_back(epicenter + point(i, -i), c_red, '\\');
+  ring.emplace_back(epicenter + point(-i, i), c_red, '\\');
+  ring.emplace_back(epicenter + point(i, i), c_red, '/');
+  for (int j = 1 - i; j < 0 + i; j++) {
+   ring.emplace_back(epicenter + point(j, -i), c_red, '-');
+   ring.emplace_back(epicenter + point(j, i), c_red, '-');
+   ring.emplace_back(epicenter + point(-i, j), c_red, '|');
+   ring.emplace_back(epicenter + point(i, j), c_red, '|');
+  }
+  animation::get().add(std::move(ring), EXPLOSION_SPEED);
+ }
+}
+
 void game::explosion(const point& pt, int power, int shrapnel, bool fire)
 {
  if (0 >= power) return; // no-op if zero power (could happen if vehicle gas tank near-empty
 
- timespec ts = { 0, EXPLOSION_SPEED };	// Timespec for the animation of the explosion
  int radius = sqrt(double(power / 4));
  int dam;
  if (power >= 30)
   sound(pt, power * 10, "a huge explosion!");
  else
   sound(pt, power * 10, "an explosion!");
+ const blast_occupants occupants(toGPS(pt), 2 * radius);   // shrapnel reaches twice as far as the blast
  for (int i = pt.x - radius; i <= pt.x + radius; i++) {
   for (int j = pt.y - radius; j <= pt.y + radius; j++) {
    if (i == pt.x && j == pt.y)
@@ -2796,7 +3024,7 @@ void game::explosion(const point& pt, int power, int shrapnel, bool fire)
    if (m.has_flag(bashable, i, j)) m.bash(i, j, dam); // Double up for tough doors, etc.
    if (m.is_destructable(i, j) && rng(25, 100) < dam) m.destroy(this, i, j, false);
 
-   if (auto _mob = mob_at(point(i, j))) std::visit(hit_by_explosion(dam, point(i,j)), *_mob);
+   if (auto _mob = occupants.at(toGPS(point(i, j)))) std::visit(hit_by_explosion(dam, point(i,j)), *_mob);
 
    if (fire) {
 	auto& f = m.field_at(i, j);
@@ -2806,43 +3034,29 @@ void game::explosion(const point& pt, int power, int shrapnel, bool fire)
   }
  }
 // Draw the explosion
- const point epicenter(pt + point(VIEW_CENTER) - u.pos);
- for (int i = 1; i <= radius; i++) {
-  mvwputch(w_terrain, epicenter.y - i, epicenter.x - i, c_red, '/');
-  mvwputch(w_terrain, epicenter.y - i, epicenter.x + i, c_red,'\\');
-  mvwputch(w_terrain, epicenter.y + i, epicenter.x - i, c_red,'\\');
-  mvwputch(w_terrain, epicenter.y + i, epicenter.x + i, c_red, '/');
-  for (int j = 1 - i; j < 0 + i; j++) {
-   mvwputch(w_terrain, epicenter.y - i, epicenter.x + j, c_red,'-');
-   mvwputch(w_terrain, epicenter.y + i, epicenter.x + j, c_red,'-');
-   mvwputch(w_terrain, epicenter.y + j, epicenter.x - i, c_red,'|');
-   mvwputch(w_terrain, epicenter.y + j, epicenter.x + i, c_red,'|');
-  }
-  wrefresh(w_terrain);
-  nanosleep(&ts, nullptr);
- }
+ const bool animate = animation::enabled();
+ if (animate) explosion_rings(toGPS(pt), radius);
 
 // The rest of the function is shrapnel
  if (shrapnel <= 0) return;
  int sx, sy;
  std::vector<point> traj;
- ts.tv_sec = 0;
- ts.tv_nsec = BULLET_SPEED;	// Reset for animation of bullets
+ std::vector<GPS_loc> restore;
  for (int i = 0; i < shrapnel; i++) {
   sx = rng(pt.x - 2 * radius, pt.x + 2 * radius);
   sy = rng(pt.y - 2 * radius, pt.y + 2 * radius);
   traj = line_to(pt.x, pt.y, sx, sy, m.sees(pt, sx, sy, 50));
   dam = rng(20, 60);
   for (int j = 0; j < traj.size(); j++) {
-   if (j > 0 && u.see(traj[j - 1]))
-    m.drawsq(w_terrain, u, traj[j - 1].x, traj[j - 1].y, false, true);
-   if (u.see(traj[j])) {
-    const point draw_at(traj[j] + point(VIEW_CENTER) - u.pos);
-    mvwputch(w_terrain, draw_at.y, draw_at.x, c_red, '`');
-    wrefresh(w_terrain);
-    nanosleep(&ts, nullptr);
+   if (animate) {
+    if (j > 0 && u.see(traj[j - 1])) restore.push_back(toGPS(traj[j - 1]));
+    if (u.see(traj[j])) {
+     std::vector<animation::glyph> bullet(1, animation::glyph(toGPS(traj[j]), c_red, '`'));
+     animation::get().add(std::move(bullet), BULLET_SPEED, std::move(restore));
+     restore.clear();
+    }
    }
-   if (auto mob = mob_at(traj[j])) {
+   if (auto mob = occupants.at(toGPS(traj[j]))) {
     std::visit(hit_by_shrapnel(dam), *mob);
    } else
     m.shoot(this, traj[j], dam, j == traj.size() - 1, 0);
@@ -2861,18 +3075,20 @@ void GPS_loc::explosion(int power, int shrapnel, bool fire) const
     else
         sound(power * 10, "an explosion!");
 
-    forall_do_inclusive(zaimoni::gdi::box<point>(point(-radius), point(radius)), [=,this](point delta) {
+    const blast_occupants occupants(*this, 2 * radius);   // shrapnel reaches twice as far as the blast
+    GPS_cursor scan(*this);
+    forall_do_inclusive(zaimoni::gdi::box<point>(point(-radius), point(radius)), [&,this](point delta) {
         int dam = (point(0) == delta) ? 3 * power : 3 * power / Linf_dist(delta);
-        auto loc = *this + delta;
+        auto loc = scan.seek(delta);
         std::string discard;
         if (loc.is_bashable()) loc.bash(dam, discard);
         if (loc.is_bashable()) loc.bash(dam, discard); // Double up for tough doors, etc.
         if (loc.is_destructable() && rng(25, 100) < dam) loc.destroy(false);
 
-        if (auto _mob = game::active()->mob_at(loc)) std::visit(hit_by_explosion(dam, loc), *_mob);
+        if (auto _mob = occupants.at(loc)) std::visit(hit_by_explosion(dam, loc), *_mob);
 
         if (fire) {
-            auto& f = loc.field_at();
+            auto& f = scan.field_at();
             if (fd_smoke == f.type) f = field(fd_fire);
             loc.add(field(fd_fire, dam / 10));
         }
@@ -2881,27 +3097,13 @@ void GPS_loc::explosion(int power, int shrapnel, bool fire) const
     // Draw the explosion
     auto full_epicenter = *this - g->u.GPSpos;
     if (std::get_if<tripoint>(&full_epicenter)) return; // \todo build out multi-level display
-    auto epicenter = std::get<point>(full_epicenter) + point(VIEW_CENTER);
-    timespec ts = { 0, EXPLOSION_SPEED };	// Timespec for the animation of the explosion
-    for (int i = 1; i <= radius; i++) {
-        mvwputch(g->w_terrain, epicenter.y - i, epicenter.x - i, c_red, '/');
-        mvwputch(g->w_terrain, epicenter.y - i, epicenter.x + i, c_red, '\\');
-        mvwputch(g->w_terrain, epicenter.y + i, epicenter.x - i, c_red, '\\');
-        mvwputch(g->w_terrain, epicenter.y + i, epicenter.x + i, c_red, '/');
-        for (int j = 1 - i; j < 0 + i; j++) {
-            mvwputch(g->w_terrain, epicenter.y - i, epicenter.x + j, c_red, '-');
-            mvwputch(g->w_terrain, epicenter.y + i, epicenter.x + j, c_red, '-');
-            mvwputch(g->w_terrain, epicenter.y + j, epicenter.x - i, c_red, '|');
-            mvwputch(g->w_terrain, epicenter.y + j, epicenter.x + i, c_red, '|');
-        }
-        wrefresh(g->w_terrain);
-        nanosleep(&ts, nullptr);
-    }
+    const bool animate = animation::enabled();
+    if (animate) game::explosion_rings(*this, radius);
 
     // The rest of the function is shrapnel
     if (shrapnel <= 0) return;
     const zaimoni::gdi::box<point> shrapnel_aoe(point(-2 * radius), point(2 * radius));
-    ts = { 0, BULLET_SPEED };	// Timespec for the animation of bullets
+    std::vector<GPS_loc> restore;
     for (int i = 0; i < shrapnel; i++) {
         auto dest = *this + rng(shrapnel_aoe);
         auto traj = this->sees(dest, 50);
@@ -2910,17 +3112,17 @@ void GPS_loc::explosion(int power, int shrapnel, bool fire) const
         std::optional<GPS_loc> prev;
         ptrdiff_t j = traj->size();
         for (decltype(auto) loc : *traj) {
-            if (prev && g->u.see(*prev))
-                g->m.drawsq(g->w_terrain, g->u, *prev, false, true);
+            if (animate) {
+                if (prev && g->u.see(*prev)) restore.push_back(*prev);
+                if (g->u.see(loc)) {
+                    std::vector<animation::glyph> bullet(1, animation::glyph(loc, c_red, '`'));
+                    animation::get().add(std::move(bullet), BULLET_SPEED, std::move(restore));
+                    restore.clear();
+                }
+            }
             prev = loc;
             --j;
-            if (g->u.see(loc)) {
-                const point draw_at = std::get<point>(loc - g->u.GPSpos) + point(VIEW_CENTER);
-                mvwputch(g->w_terrain, draw_at.y, draw_at.x, c_red, '`');
-                wrefresh(g->w_terrain);
-                nanosleep(&ts, nullptr);
-            }
-            if (auto mob = g->mob_at(loc)) {
+            if (auto mob = occupants.at(loc)) {
                 std::visit(hit_by_shrapnel(dam), *mob);
             } else
                 loc.shoot(dam, 0 == j, 0);
@@ -3233,46 +3435,6 @@ std::optional<std::vector<std::pair<std::variant<monster*, npc*, pc*>, int> > >
     return std::nullopt;
 }
 
-void game::forall_do(std::function<void(monster&)> op) { for (decltype(auto) _mon : z) op(_mon); }
-void game::forall_do(std::function<void(const monster&)> op) const { for (decltype(auto) _mon : z) op(_mon); }
-
-void game::forall_do(std::function<void(player&)> op) {
-    op(u);
-    for (decltype(auto) _npc : active_npc) op(*_npc);
-}
-
-void game::forall_do(std::function<void(const player&)> op) const {
-    op(u);
-    for (decltype(auto) _npc : active_npc) op(*_npc);
-}
-
-void game::forall_do(std::function<void(npc&)> op) {
-    for (decltype(auto) _npc : active_npc) op(*_npc);
-}
-
-void game::forall_do(std::function<void(const npc&)> op) const {
-    for (decltype(auto) _npc : active_npc) op(*_npc);
-}
-
-size_t game::count(std::function<bool(const monster&)> ok) const
-{
-    size_t ret = 0;
-    for (decltype(auto) _mon : z) if (ok(_mon)) ret++;
-    return ret;
-}
-
-const monster* game::find_first(std::function<bool(const monster&)> ok) const
-{
-    for (decltype(auto) _mon : z) if (ok(_mon)) return &_mon;
-    return nullptr;
-}
-
-const npc* game::find_first(std::function<bool(const npc&)> ok) const
-{
-    for (decltype(auto) _npc : active_npc) if (ok(*_npc)) return _npc.get();
-    return nullptr;
-}
-
 bool game::exec_first(std::function<std::optional<bool>(npc&) > op)
 {
     ptrdiff_t i = -1;
@@ -3293,12 +3455,12 @@ void game::spawn(npc&& whom)
 
 void game::spawn(const monster& whom)
 {
-    z.push_back(whom);
+    _z_index(z.insert(whom));
 }
 
 void game::spawn(monster&& whom)
 {
-    z.push_back(std::move(whom));
+    _z_index(z.insert(std::move(whom)));
 }
 
 bool game::is_empty(const point& pt) const
@@ -4398,9 +4560,9 @@ void game::draw_targets(const std::vector<std::pair<std::variant<monster*, npc*,
 int game::visible_monsters(std::vector<const monster*>& mon_targets, std::vector<int>& targetindices, std::function<bool(const monster&)> test) const
 {
     int passtarget = -1;
-    int i2 = -1;
-    for (const auto& mon : z) {
-        ++i2;
+    for (auto it = z.begin(); it != z.end(); ++it) {
+        const auto& mon = *it;
+        const int i2 = it.index();
         if (u.see(mon) && test(mon)) {
             mon_targets.push_back(&mon);
             targetindices.push_back(i2);
@@ -5128,7 +5290,7 @@ void game::vertical_move(int movez, bool force)
       } else despawn(_mon);
   }
  }
- z.clear();
+ z_clear();
 
 // Figure out where we know there are up/down connectors
  std::vector<point> discover;
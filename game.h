@@ -12,10 +12,14 @@
 #include "monster.h"
 #include "line.h"   // for direction enum
 #include "recent_msg.h"
+#include "slot_map.hpp"
 #include "Zaimoni.STL/Logging.h"
 #include "Zaimoni.STL/GDI/box.hpp"
+#include <map>
 #include <memory>
 #include <optional>
+#include <type_traits>
+#include <utility>
 
 // this is a god header and has the required includes \todo better location for these reality checks
 static_assert(mobile::mp_turn == calendar::mp_turn);
@@ -103,6 +107,7 @@ class game : public reality_bubble
 
 // Explosion at (x, y) of intensity (power), with (shrapnel) chunks of shrapnel
   void explosion(const point& pt, int power, int shrapnel, bool fire);
+  static void explosion_rings(const GPS_loc& epicenter, int radius); // queues the animation
   void flashbang(const GPS_loc& pt);
   // Move the player vertically, if (force) then they fell
   void vertical_move(int z, bool force);
@@ -128,17 +133,48 @@ class game : public reality_bubble
   std::optional<std::variant<const monster*, const npc*, const pc*> > mob_at(const GPS_loc& gps) const;
   std::optional<std::vector<std::variant<monster*, npc*, pc*> > > mobs_in_range(const GPS_loc& gps, int range);
   std::optional<std::vector<std::pair<std::variant<monster*, npc*, pc*> , int> > > mobs_with_range(const GPS_loc& gps, int range);
-  void forall_do(std::function<void(monster&)> op);
-  void forall_do(std::function<void(const monster&)> op) const;
-  void forall_do(std::function<void(player&)> op);
-  void forall_do(std::function<void(const player&)> op) const;
-  void forall_do(std::function<void(npc&)> op);
-  void forall_do(std::function<void(const npc&)> op) const;
-  size_t count(std::function<bool(const monster&)> ok) const;
-  const monster* find_first(std::function<bool(const monster&)> ok) const;
-  monster* find_first(std::function<bool(const monster&)> ok) { return const_cast<monster*>(const_cast<const game*>(this)->find_first(ok)); }
-  const npc* find_first(std::function<bool(const npc&)> ok) const;
-  npc* find_first(std::function<bool(const npc&)> ok) { return const_cast<npc*>(const_cast<const game*>(this)->find_first(ok)); }
+  // op's parameter type selects what is visited: monsters, players (PC then active NPCs), or active NPCs only
+  template<class F> void forall_do(F&& op) {
+   if constexpr (std::is_invocable_v<F&, monster&>) {
+    for (decltype(auto) _mon : z) op(_mon);
+   } else if constexpr (std::is_invocable_v<F&, player&>) {
+    op(u);
+    for (decltype(auto) _npc : active_npc) op(*_npc);
+   } else {
+    static_assert(std::is_invocable_v<F&, npc&>);
+    for (decltype(auto) _npc : active_npc) op(*_npc);
+   }
+  }
+  template<class F> void forall_do(F&& op) const {
+   if constexpr (std::is_invocable_v<F&, const monster&>) {
+    for (decltype(auto) _mon : z) op(_mon);
+   } else if constexpr (std::is_invocable_v<F&, const player&>) {
+    op(u);
+    for (decltype(auto) _npc : active_npc) op(std::as_const(*_npc));
+   } else {
+    static_assert(std::is_invocable_v<F&, const npc&>);
+    for (decltype(auto) _npc : active_npc) op(std::as_const(*_npc));
+   }
+  }
+  template<class F> size_t count(F&& ok) const {
+   size_t ret = 0;
+   for (decltype(auto) _mon : z) if (ok(_mon)) ret++;
+   return ret;
+  }
+  // ok's parameter type selects monsters or active NPCs
+  template<class F> auto find_first(F&& ok) const {
+   if constexpr (std::is_invocable_v<F&, const monster&>) {
+    for (decltype(auto) _mon : z) if (ok(_mon)) return &_mon;
+    return static_cast<const monster*>(nullptr);
+   } else {
+    for (decltype(auto) _npc : active_npc) if (ok(std::as_const(*_npc))) return static_cast<const npc*>(_npc.get());
+    return static_cast<const npc*>(nullptr);
+   }
+  }
+  template<class F> auto find_first(F&& ok) {
+   const auto ret = std::as_const(*this).find_first(ok);
+   return const_cast<std::remove_const_t<std::remove_pointer_t<decltype(ret)> >*>(ret);
+  }
   bool exec_first(std::function<std::optional<bool>(npc&) > op);
   void spawn(npc&& whom);
   void spawn(const monster& whom);
@@ -205,7 +241,7 @@ class game : public reality_bubble
   signed char temperature;              // The air temperature
   weather_type weather;			// Weather pattern--SEE weather.h
   pc u;
-  std::vector<monster> z;
+  slot_map<monster> z;	// indexes are stable for a monster's lifetime (cf. pc::target).  Add with spawn, remove with z_erase/z_clear
   std::vector<monster_and_count> coming_to_stairs;
   tripoint monstair;
   npcs_t active_npc;
@@ -228,6 +264,10 @@ class game : public reality_bubble
   WINDOW *w_status;
 
  private:
+  std::map<tripoint, std::vector<size_t> > _z_by_submap;	// z indexes by GPSpos.first; cf. z_near
+  void _z_index(size_t i);
+  bool _z_unindex(size_t i, decltype(_z_by_submap)::iterator bucket);
+
 // Game-start procedures
   bool opening_screen();// Warn about screen size, then present the main menu
   bool load_master();	// Load the master data file, with factions &c
@@ -337,6 +377,19 @@ public:
 
   // data integrity
   void z_erase(std::function<bool(monster&)> reject);
+  void z_clear();
+  void z_moved(const monster& whom, const tripoint& from);	// whom's submap may have changed; no-op if whom is not in z
+
+  // op(index, monster) for each monster in z filed under submaps [tl, br] (same z-level); callers check exact position
+  template<class F> void z_near(const tripoint& tl, const tripoint& br, F op) {
+      for (int x = tl.x; x <= br.x; x++) {
+          for (int y = tl.y; y <= br.y; y++) {
+              const auto bucket = _z_by_submap.find(tripoint(x, y, tl.z));
+              if (_z_by_submap.end() == bucket) continue;
+              for (const size_t i : bucket->second) if (auto _mon = z.at(i)) op(i, *_mon);
+          }
+      }
+  }
 
 // ########################## DATA ################################
 
@@ -13,6 +13,11 @@ static const std::string open_attr_val("=\"");
 static const std::string close_attr_val("\"");
 static const std::string quot_entity("&quot;");
 
+static void _put(const std::string& src, FILE* dest)
+{
+	if (!src.empty()) fwrite(src.data(), 1, src.size(), dest);
+}
+
 // \todo fix these to account for text/content interactions
 void tag::append(const tag& src)
 {
@@ -120,6 +125,47 @@ std::string tag::to_s_end() const
 	return start_closing_tag + _name + end_tag;
 }
 
+void tag::write(FILE* dest) const
+{
+	const bool has_name = !_name.empty();
+	if (_content.empty() && _text.empty()) {
+		if (has_name) {
+			_put(start_opening_tag, dest);
+			_put(_name, dest);
+			_put(end_selfclose_tag, dest);
+		}
+		return;
+	}
+	write_start(dest);
+	write_content(dest);
+	if (has_name) {
+		_put(start_closing_tag, dest);
+		_put(_name, dest);
+		_put(end_tag, dest);
+	}
+}
+
+void tag::write_start(FILE* dest) const
+{
+	if (_name.empty()) return;
+	_put(start_opening_tag, dest);
+	_put(_name, dest);
+	for (auto& x : _attr) {
+		_put(space, dest);
+		_put(x.first, dest);
+		_put(open_attr_val, dest);
+		_put(x.second, dest);
+		_put(close_attr_val, dest);
+	}
+	_put(end_tag, dest);
+}
+
+void tag::write_content(FILE* dest) const
+{
+	if (!_text.empty()) _put(_text, dest);
+	else for (auto& x : _content) x.write(dest);
+}
+
 tag* tag::querySelector(const std::string& selector)
 {
 	if (selector.empty()) return nullptr;
@@ -184,33 +230,39 @@ tag* tag::_querySelector_attr_val(const std::string& key, const std::string& val
 }
 
 
-void to_text::print(const tag& src) {
-	auto _html = src.to_s();
-	if (!_html.empty()) fwrite(_html.c_str(), 1, _html.size(), dest);
+void to_text::_finish_start()
+{
+	if (_start_pending) {
+		_put(end_tag, dest);
+		_start_pending = false;
+	}
 }
 
-static void _start_print(const tag& src, FILE* dest)
-{
-	auto _html = src.to_s_start();
-	if (!_html.empty()) fwrite(_html.c_str(), 1, _html.size(), dest);
-	_html = src.to_s_content();
-	if (!_html.empty()) fwrite(_html.c_str(), 1, _html.size(), dest);
+void to_text::print(const tag& src) {
+	_finish_start();
+	src.write(dest);
 }
 
 void to_text::start_print(const tag& src) {
-	_start_print(src, dest);
+	_finish_start();
+	src.write_start(dest);
+	src.write_content(dest);
 	_stack.push_back(src);
 }
 
 void to_text::start_print(tag&& src) {
-	_start_print(src, dest);
+	_finish_start();
+	src.write_start(dest);
+	src.write_content(dest);
 	_stack.push_back(std::move(src));
 }
 
 bool to_text::end_print() {
 	if (!_stack.empty()) {
-		auto _html = _stack.back().to_s_end();
-		if (!_html.empty()) fwrite(_html.c_str(), 1, _html.size(), dest);
+		if (_start_pending) {	// streamed tag with no content
+			_put(end_selfclose_tag, dest);
+			_start_pending = false;
+		} else _put(_stack.back().to_s_end(), dest);
 		_stack.pop_back();
 	}
 	return !_stack.empty();
@@ -218,12 +270,64 @@ bool to_text::end_print() {
 
 void to_text::raw_copy(FILE* src)
 {
+	_finish_start();
 	int ch;
 	while (EOF != (ch = fgetc(src))) {
 		if (EOF == fputc(ch, dest)) break;
 	}
 }
 
+to_text& to_text::open(const std::string& name)
+{
+	_finish_start();
+	_put(start_opening_tag, dest);
+	_put(name, dest);
+	_stack.push_back(tag(name));
+	_start_pending = true;
+	return *this;
+}
+
+to_text& to_text::attr(const std::string& key, const std::string& val)
+{
+#ifndef NDEBUG
+	if (!_start_pending) throw std::logic_error("attribute after start tag was completed");
+#endif
+	_put(space, dest);
+	_put(key, dest);
+	_put(open_attr_val, dest);
+	for (const char ch : val) {
+		if ('"' == ch) _put(quot_entity, dest);
+		else fputc(ch, dest);
+	}
+	_put(close_attr_val, dest);
+	return *this;
+}
+
+to_text& to_text::text(const char* src)
+{
+	if (!src || !*src) return *this;
+	_finish_start();
+	while (const char ch = *src++) {
+		switch (ch) {
+		case '&': fputs("&amp;", dest); break;
+		case '<': fputs("&lt;", dest); break;
+		case '>': fputs("&gt;", dest); break;
+		default: fputc(ch, dest);
+		}
+	}
+	return *this;
+}
+
+to_text& to_text::text(const std::string& src) { return text(src.c_str()); }
+
+to_text& to_text::raw(const std::string& src)
+{
+	if (src.empty()) return *this;
+	_finish_start();
+	_put(src, dest);
+	return *this;
+}
+
 static bool id_identity_char(unsigned char src)
 {
 	if ('-' == src) return true;
@@ -103,6 +103,11 @@ public:
 	std::string to_s_content() const;
 	std::string to_s_end() const;
 
+	// directly to a FILE*; same output as the to_s family without building intermediate strings
+	void write(FILE* dest) const;
+	void write_start(FILE* dest) const;
+	void write_content(FILE* dest) const;
+
 	// infrastructure
 	static std::string& destructive_quot_escape(std::string& x);	// returns reference to x
 private:
@@ -115,8 +120,11 @@ class to_text final
 private:
 	std::vector<tag> _stack;
 	FILE* dest;
+	bool _start_pending;	// streamed start tag still accepting attributes
 public:
-	to_text(FILE* src) : dest(src) {};
+	to_text(FILE* src) : dest(src), _start_pending(false) {
+		if (dest) setvbuf(dest, nullptr, _IOFBF, 1 << 16);
+	};
 	to_text(const to_text& src) = delete;
 	to_text(to_text&& src) = delete;
 	~to_text() {
@@ -131,6 +139,21 @@ public:
 	void start_print(tag&& src);
 	bool end_print(); // returns true iff no more tags to complete printing
 	void raw_copy(FILE* src);
+
+	// streaming interface: large tables should not have to be built as tag trees first.
+	// open() tags are closed by close() or end_print() just like start_print() tags.
+	to_text& open(const std::string& name);
+	to_text& attr(const std::string& key, const std::string& val);	// only valid immediately after open()
+	to_text& text(const std::string& src);	// escapes &, <, >
+	to_text& text(const char* src);
+	to_text& raw(const std::string& src);	// src is already HTML
+	to_text& close() {
+		end_print();
+		return *this;
+	}
+
+private:
+	void _finish_start();
 };
 
 std::string encode_id(const char* src);
@@ -141,9 +141,10 @@ void inventory::restack(player *p)
 }
 
 inventory::inventory(const GPS_loc& origin, int range) {
+    GPS_cursor src(origin);
     for (int x = -range; x <= range; x++) {
         for (int y = -range; y <= range; y++) {
-            GPS_loc src = origin + point(x, y);
+            src.seek(point(x, y));
             for (auto& obj : src.items_at()) if (!obj.made_of(LIQUID)) add_item(obj);
             // Kludge for now!
             if (fd_fire == src.field_at().type) {
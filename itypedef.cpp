@@ -742,6 +742,7 @@ namespace cataclysm {
 //  any appropriate lists.
 void item::init()
 {
+ types.reserve(num_all_items);	// artifacts are appended later, at game start/load
 // First, the null object.  NOT REALLY AN OBJECT AT ALL.  More of a concept.
  types.push_back(null_type);
 // Corpse - a special item
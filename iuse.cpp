@@ -2273,7 +2273,7 @@ void iuse::artifact(pc& p, item& it)
   } break;
 
   case AEA_BLOOD: {
-      static std::function<bool(point)> ooze_blood = [&](point delta) {
+      auto ooze_blood = [&](point delta) -> bool {
           auto dest = p.GPSpos + delta;
           if (  !one_in(4) && dest.add(field(fd_blood, 3))
               && g->u.see(dest))    // \todo? optimize out this visibility check?
@@ -1,4 +1,5 @@
 #include "json.h"
+#include "profile.hpp"
 #include <type_traits>
 #include <stdexcept>
 #include <istream>
@@ -385,6 +386,7 @@ static const std::string JSON_read_failed("JSON read failed before end of file,
 JSON::JSON(std::istream& src)
 : _scalar(nullptr), _mode(none)
 {
+	PROFILE_SCOPE("JSON parse");
 	src.exceptions(std::ios::badbit);	// throw on hardware failure
 	char last_read = ' ';
 	unsigned long line = 1;
@@ -8,11 +8,14 @@
 #include "json.h"
 #include "recent_msg.h"
 #include "om_cache.hpp"
+#include "profile.hpp"
 #include "stl_limits.h"
 #include "inline_stack.hpp"
 #include "fragment.inc/rng_box.hpp"
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <queue>
 #include <cmath>
 #include <stdlib.h>
 
@@ -98,48 +101,115 @@ std::optional<point> map::find_terrain(const point& pt, const ter_id dest) const
     return ok;
 }
 
-std::vector<point> map::grep(const point& tl, const point& br, std::function<bool(point)> test)
+std::optional<std::pair<const vehicle*, int>> map::veh_at(const reality_bubble_loc& src) const
 {
-    std::vector<point> ret;
-    if (tl.x <= br.x && tl.y <= br.y) {
-        point pt;
-        for (pt.x = tl.x; pt.x <= br.x; pt.x++) {
-            for (pt.y = tl.y; pt.y <= br.y; pt.y++) {
-                if (test(pt)) ret.push_back(pt);
-            }
+    if (auto ret = const_cast<map*>(this)->veh_at(src)) return std::pair(ret->first, ret->second);
+    return std::nullopt;
+}
+
+void map::_rebuild_veh_grid()
+{
+    const int span = SEE * my_MAPSIZE;
+    _veh_grid.assign(span * span, std::pair<vehicle*, int>(nullptr, -1));
+    _veh_cells.clear();
+
+    const auto nonant_ub = my_MAPSIZE * my_MAPSIZE;
+    for (int n = 0; n < nonant_ub; n++) {
+        if (!grid[n]) continue;
+        for (decltype(auto) veh : grid[n]->all_vehicles(Badge<map>())) {
+            _index(*veh, toScreen(reality_bubble_loc(n, veh->GPSpos.second)));
         }
     }
-    return ret;
 }
 
-std::optional<std::pair<const vehicle*, int>> map::veh_at(const reality_bubble_loc& src) const
+static bool _by_cell(const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) { return lhs.first < rhs.first; }
+
+void map::_index(vehicle& veh, const point& origin)
 {
-    if (auto ret = const_cast<map*>(this)->veh_at(src)) return std::pair(ret->first, ret->second);
-    return std::nullopt;
+    const int span = SEE * my_MAPSIZE;
+    std::vector<std::pair<int, int> > cells;
+    for (const int p : veh.external_parts) {
+        const point pt = origin + veh.parts[p].precalc_d[0];
+        if (0 > pt.x || span <= pt.x || 0 > pt.y || span <= pt.y) continue;
+        cells.push_back(std::pair(pt.x + pt.y * span, p));
+    }
+    if (cells.empty()) return;
+    // first part listed wins, as vehicle::part_at
+    std::stable_sort(cells.begin(), cells.end(), _by_cell);
+    cells.erase(std::unique(cells.begin(), cells.end(), [](const auto& lhs, const auto& rhs) { return lhs.first == rhs.first; }), cells.end());
+    for (const auto& x : cells) {
+        auto& dest = _veh_grid[x.first];
+        if (!dest.first) dest = std::pair(&veh, x.second);  // vehicles shouldn't intersect, but collisions can leave them overlapping
+    }
+    _veh_cells[&veh] = std::move(cells);
+}
+
+void map::_unindex(const vehicle& veh)
+{
+    const auto it = _veh_cells.find(&veh);
+    if (_veh_cells.end() == it) return;
+    const auto cells = std::move(it->second);
+    _veh_cells.erase(it);
+    for (const auto& x : cells) {
+        auto& dest = _veh_grid[x.first];
+        if (&veh != dest.first) continue;
+        dest = std::pair<vehicle*, int>(nullptr, -1);
+        // hand the cell to an overlapping vehicle, if any
+        for (const auto& other : _veh_cells) {
+            const auto hit = std::lower_bound(other.second.begin(), other.second.end(), x, _by_cell);
+            if (other.second.end() == hit || hit->first != x.first) continue;
+            dest = std::pair(const_cast<vehicle*>(other.first), hit->second); // every key came in through _index(vehicle&)
+            break;
+        }
+    }
+}
+
+void map::reindex(vehicle& veh, const Badge<vehicle>& auth)
+{
+    if (_veh_grid.empty()) return;  // will be rebuilt in full
+    _unindex(veh);
+    if (const auto pos = to(veh.GPSpos); pos && toGPS(*pos) == veh.GPSpos) _index(veh, toScreen(*pos));  // skip mid-reload
+}
+
+void map::unindex(const vehicle& veh, const Badge<vehicle>& auth)
+{
+    if (!_veh_grid.empty()) _unindex(veh);
 }
 
 std::optional<std::pair<vehicle*, int>> map::veh_at(const reality_bubble_loc& src)
 {
-    GPS_loc origin = grid[src.first]->toGPS(src.second, Badge<map>());
-    // must check 3x3 map chunks, as vehicle part may span to neighbour chunk
-    // we presume that vehicles don't intersect (they shouldn't by any means)
-    const auto nonant_ub = my_MAPSIZE * my_MAPSIZE;
-    for (int mx = -1; mx <= 1; mx++) {
-        // C:Z: disallow wraparound to next row N/S of ours
-        if (-1 == mx && 0 ==  src.first    % my_MAPSIZE) continue;
-        if ( 1 == mx && 0 == (src.first+1) % my_MAPSIZE) continue;
-        for (int my = -1; my <= 1; my++) {
-            int nonant1 = src.first + mx + my * my_MAPSIZE;
-            if (nonant1 < 0 || nonant1 >= nonant_ub) continue; // out of grid
-            if (auto ret = grid[nonant1]->veh_at(origin)) return ret;
+    if (this != &game::active()->m) {   // only the game's map is told about vehicle movement; scan the 3x3 submaps
+        const GPS_loc origin = grid[src.first]->toGPS(src.second, Badge<map>());
+        // must check 3x3 map chunks, as vehicle part may span to neighbour chunk
+        // we presume that vehicles don't intersect (they shouldn't by any means)
+        const auto nonant_ub = my_MAPSIZE * my_MAPSIZE;
+        for (int mx = -1; mx <= 1; mx++) {
+            // C:Z: disallow wraparound to next row N/S of ours
+            if (-1 == mx && 0 == src.first % my_MAPSIZE) continue;
+            if (1 == mx && 0 == (src.first + 1) % my_MAPSIZE) continue;
+            for (int my = -1; my <= 1; my++) {
+                const int nonant1 = src.first + mx + my * my_MAPSIZE;
+                if (nonant1 < 0 || nonant1 >= nonant_ub) continue; // out of grid
+                if (auto ret = grid[nonant1]->veh_at(origin)) return ret;
+            }
         }
+        return std::nullopt;
     }
+    if (_veh_grid.empty()) _rebuild_veh_grid();
+    const point pt = toScreen(src);
+    const auto& ret = _veh_grid[pt.x + pt.y * SEE * my_MAPSIZE];
+    if (ret.first) return ret;
     return std::nullopt;
 }
 
 // \todo if map::veh_at goes dead code then relocate (overmap.cpp? new GPS_loc.cpp?)
 std::optional<std::pair<vehicle*, int>> GPS_loc::veh_at() const
 {
+    if (const auto pos = map::to(*this)) {
+        auto& m = game::active()->m;
+        if (m.toGPS(*pos) == *this) return m.veh_at(*pos); // reality bubble (and not mid-reload): use its occupancy grid
+    }
+
     // must check 3x3 map chunks, as vehicle part may span to neighbour chunk
     // we presume that vehicles don't intersect (they shouldn't by any means)
     submap* const local_map[3][3] = { {MAPBUFFER.lookup_submap(first + Direction::NW), MAPBUFFER.lookup_submap(first + Direction::N), MAPBUFFER.lookup_submap(first + Direction::NE)},
@@ -263,7 +333,7 @@ bool map::displace_vehicle(std::shared_ptr<vehicle> veh, const point& delta, boo
       psg->screenpos_add(delta + veh->parts[p].precalc_d[1] - veh->parts[p].precalc_d[0]);
   }
  }
- for (auto& part : veh->parts) part.precalc_d[0] = part.precalc_d[1];
+ veh->advance_mounts();
 
  // not going off-grid
  if (dest_sm) {
@@ -272,6 +342,7 @@ bool map::displace_vehicle(std::shared_ptr<vehicle> veh, const point& delta, boo
          dest_sm->add(veh, Badge<map>());
          src_sm->destroy(*veh);
      }
+     veh->layout_changed();
  }
 
  bool was_update = false;
@@ -284,26 +355,97 @@ bool map::displace_vehicle(std::shared_ptr<vehicle> veh, const point& delta, boo
  return (src_sm != dest_sm) || was_update;
 }
 
+void map::vehicle_started(const vehicle& veh)
+{
+    if (submap* const sm = chunk(veh.GPSpos)) sm->moving_vehicles(in_motion, Badge<map>());
+}
+
+vehicle_obstacles map::obstacles_near(const vehicle& veh, const point& delta)
+{
+    const auto g = game::active();
+    const auto reach = veh.footprint(1) + delta;   // where our external parts will be, relative to veh.GPSpos
+
+    vehicle_obstacles ret;
+    g->z_near((veh.GPSpos + reach.tl_c()).first, (veh.GPSpos + reach.br_c()).first, [&](size_t i, const monster& _mon) {
+        if (_mon.dead) return;
+        const auto pos = _mon.GPSpos - veh.GPSpos;
+        if (const point* const pt = std::get_if<point>(&pos); pt && reach.contains(*pt)) ret.mons.push_back(g->z.handle_of(i));
+    });
+    g->forall_do([&](player& p) {
+        const auto pos = p.GPSpos - veh.GPSpos;
+        if (const point* const pt = std::get_if<point>(&pos); pt && reach.contains(*pt)) ret.survivors.push_back(&p);
+    });
+
+    // other vehicles' parts may be up to vehicle::radius from their own position
+    const auto origin = to(veh.GPSpos);
+    if (!origin) return ret;
+    const point bubble_origin = toScreen(*origin);
+    const point tl = (bubble_origin + reach.tl_c() - point(vehicle::radius)) / SEE;
+    const point br = (bubble_origin + reach.br_c() + point(vehicle::radius)) / SEE;
+    for (int sm_x = (0 < tl.x ? tl.x : 0); sm_x <= br.x && sm_x < my_MAPSIZE; sm_x++) {
+        for (int sm_y = (0 < tl.y ? tl.y : 0); sm_y <= br.y && sm_y < my_MAPSIZE; sm_y++) {
+            for (decltype(auto) other : grid[sm_x + sm_y * my_MAPSIZE]->all_vehicles(Badge<map>())) {
+                if (other.get() == &veh) continue;
+                const auto pos = other->GPSpos - veh.GPSpos;
+                const point* const pt = std::get_if<point>(&pos);
+                if (!pt) continue;
+                const auto other_reach = other->footprint(0) + *pt;
+                if (   other_reach.tl_c().x <= reach.br_c().x && reach.tl_c().x <= other_reach.br_c().x
+                    && other_reach.tl_c().y <= reach.br_c().y && reach.tl_c().y <= other_reach.br_c().y)
+                    ret.vehs.push_back(other.get());
+            }
+        }
+    }
+    return ret;
+}
+
+namespace {
+
+// vehicles with the most moves left go first; ties are first-come first-served
+struct vehicle_turn {
+    int moves;
+    unsigned int seq;
+    std::weak_ptr<vehicle> veh;
+    submap* sm;
+
+    bool operator<(const vehicle_turn& rhs) const {
+        if (moves != rhs.moves) return moves < rhs.moves;
+        return seq > rhs.seq;
+    }
+};
+
+}
+
 void map::vehmove(game *g)
 {
- submap::proxy_vehicles_t vehicles_to_move;
+ // drop anything the registry no longer needs to track: destroyed, duplicated, parked, or outside the reality bubble
+ std::sort(in_motion.begin(), in_motion.end(), std::owner_less<std::weak_ptr<vehicle> >());
+ in_motion.erase(std::unique(in_motion.begin(), in_motion.end(), [](const std::weak_ptr<vehicle>& lhs, const std::weak_ptr<vehicle>& rhs) {
+     return !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
+ }), in_motion.end());
+ in_motion.erase(std::remove_if(in_motion.begin(), in_motion.end(), [&](const std::weak_ptr<vehicle>& src) {
+     const auto veh = src.lock();
+     return !veh || 0 == veh->velocity || !to(veh->GPSpos);
+ }), in_motion.end());
+ if (in_motion.empty()) return;
+
+ std::priority_queue<vehicle_turn> vehicles_to_move;
+ unsigned int seq = 0;
 
  // give vehicles movement points
- for (int i = 0; i < my_MAPSIZE; i++) {
-     for (int j = 0; j < my_MAPSIZE; j++) {
-         int sm = i + j * my_MAPSIZE;
-         grid[sm]->veh_gain_moves(vehicles_to_move, Badge<map>()); // \todo retype return value to void
-     }
+ for (decltype(auto) src : in_motion) {
+     const auto veh = src.lock();
+     veh->gain_moves(abs(veh->velocity)); // velocity is ability to make more one-tile steps per turn
+     if (0 < veh->moves) vehicles_to_move.push({ veh->moves, seq++, src, chunk(veh->GPSpos) });
  }
- if (vehicles_to_move.empty()) return;
 
  // move vehicles
  while (!vehicles_to_move.empty()) {
-     auto veh = vehicles_to_move.front().lock();
-     EraseAt(vehicles_to_move, 0);
+     submap* sm = vehicles_to_move.top().sm;
+     auto veh = vehicles_to_move.top().veh.lock();
+     vehicles_to_move.pop();
      if (!veh) continue;
      const bool pl_ctrl = veh->player_in_control(g->u);
-     submap* const sm = chunk(veh->GPSpos);
      if (!sm) continue; // \todo probable error condition
      // \todo look at wheels instead?  following is C:Whales
      auto terrain = veh->GPSpos.ter();
@@ -351,11 +493,12 @@ void map::vehmove(game *g)
 
      int imp = 0;
      // find collisions
+     const auto near = obstacles_near(*veh, delta);
      for (const int p : veh->external_parts) {
          // coords of where part will go due to movement (dx/dy)
          // and turning (precalc_dx/dy [1])
          auto ds(veh->GPSpos + delta + veh->parts[p].precalc_d[1]);
-         if (can_move) imp += veh->part_collision(p, ds);
+         if (can_move) imp += veh->part_collision(p, ds, near);
          if (veh->velocity == 0) can_move = false;
          if (!can_move) break;
      }
@@ -439,8 +582,7 @@ void map::vehmove(game *g)
              veh->turn(coll_turn);
          }
          // accept new position
-         // historically, if submap changed, we need to process grid from the beginning.
-         displace_vehicle(veh, delta);
+         if (displace_vehicle(veh, delta)) sm = chunk(veh->GPSpos);
      }
      else // can_move
          veh->stop();
@@ -449,7 +591,7 @@ void map::vehmove(game *g)
 
      // push back into processing, if indicated
      if (0 == veh->velocity) continue;
-     if (0 < veh->moves) vehicles_to_move.push_back(veh);
+     if (0 < veh->moves) vehicles_to_move.push({ veh->moves, seq++, veh, sm });
  }
 }
 
@@ -643,6 +785,79 @@ bool map::trans(const point& pt) const
  return pos ? trans(*pos) : true;
 }
 
+map::tile_planes::tile_planes(const map& m, point tl, point br)
+: _m(m)
+{
+    const int span = SEE * m.my_MAPSIZE;
+    if (0 > tl.x) tl.x = 0;
+    if (0 > tl.y) tl.y = 0;
+    if (span <= br.x) br.x = span - 1;
+    if (span <= br.y) br.y = span - 1;
+    _tl = tl;
+    _w = (tl.x <= br.x) ? br.x - tl.x + 1 : 0;
+    _h = (tl.y <= br.y) ? br.y - tl.y + 1 : 0;
+    _move_cost.resize(_w * _h, 0);
+    _flags.resize(_w * _h, 0);
+}
+
+int map::tile_planes::_index(const point& pt) const
+{
+    const int x = pt.x - _tl.x;
+    const int y = pt.y - _tl.y;
+    if (0 > x || _w <= x || 0 > y || _h <= y) return -1;
+    return x + y * _w;
+}
+
+unsigned char map::tile_planes::_movement(int i, const point& pt)
+{
+    auto& flags = _flags[i];
+    if (!(flags & KNOWN_MOVE)) {
+        const auto pos = _m.to(pt);  // always valid: constructor clipped to the map
+        _move_cost[i] = _m.move_cost(*pos);
+        if (_m.has_flag(::bashable, *pos)) flags |= BASH;
+        if (t_door_c == _m.ter(*pos)) flags |= DOOR;
+        flags |= KNOWN_MOVE;
+    }
+    return flags;
+}
+
+int map::tile_planes::move_cost(const point& pt)
+{
+    const int i = _index(pt);
+    if (0 > i) return _m.move_cost(pt);
+    _movement(i, pt);
+    return _move_cost[i];
+}
+
+bool map::tile_planes::bashable(const point& pt)
+{
+    const int i = _index(pt);
+    if (0 > i) return _m.has_flag(::bashable, pt);
+    return _movement(i, pt) & BASH;
+}
+
+bool map::tile_planes::closed_door(const point& pt)
+{
+    const int i = _index(pt);
+    if (0 > i) return t_door_c == _m.ter(pt);
+    return _movement(i, pt) & DOOR;
+}
+
+bool map::tile_planes::trans(const point& pt)
+{
+    const int i = _index(pt);
+    if (0 > i) {
+        const auto pos = _m.to(pt);
+        return pos && _m.trans(*pos);
+    }
+    auto& flags = _flags[i];
+    if (!(flags & KNOWN_TRANS)) {
+        if (_m.trans(*_m.to(pt))) flags |= TRANS;
+        flags |= KNOWN_TRANS;
+    }
+    return flags & TRANS;
+}
+
 bool map::has_flag(t_flag flag, const reality_bubble_loc& pos) const
 {
     if (flag == bashable) {
@@ -705,27 +920,121 @@ bool map::is_destructable(int x, int y) const
 
 // \todo relocate (overmap.cpp? new GPS_loc.cpp?)
 bool GPS_loc::is_outside() const
+{
+    GPS_cursor scan(*this);
+    return scan.is_outside();
+}
+
+GPS_cursor::GPS_cursor(const GPS_loc& origin) noexcept
+: _origin(origin), _loc(origin), _sm(game::active()->m.chunk(origin)), _near{}, _known(1U << 4)
+{
+    _near[1][1] = _sm;
+}
+
+submap* GPS_cursor::_resolve(const tripoint& gps)
+{
+    const tripoint delta = gps - _origin.first;
+    if (0 != delta.z || 1 < abs(delta.x) || 1 < abs(delta.y)) return game::active()->m.chunk(GPS_loc(gps, point(0, 0)));
+    const unsigned short bit = 1U << ((delta.x + 1) + 3 * (delta.y + 1));
+    submap*& ret = _near[delta.x + 1][delta.y + 1];
+    if (!(_known & bit)) {
+        ret = game::active()->m.chunk(GPS_loc(gps, point(0, 0)));
+        _known |= bit;
+    }
+    return ret;
+}
+
+const GPS_loc& GPS_cursor::seek(const point& delta)
+{
+    const GPS_loc dest(_origin + delta);
+    if (dest.first != _loc.first) _sm = _resolve(dest.first);
+    return _loc = dest;
+}
+
+ter_id GPS_cursor::ter() const
+{
+    if (_sm) return _sm->terrain(_loc.second);
+    return t_null; // Out-of-bounds - null terrain
+}
+
+field& GPS_cursor::field_at()
+{
+    if (_sm) return _sm->field_at(_loc.second);
+    return (discard<field>::x = field());	// Out-of-bounds, return null field
+}
+
+std::vector<item>& GPS_cursor::items_at()
+{
+    if (_sm) return _sm->items_at(_loc.second);
+    return (discard<std::vector<item> >::x = std::vector<item>());
+}
+
+bool GPS_cursor::is_outside()
 {
     // With proper z-levels, we would say "outside is when there are no floors above us, and arguably properly enclosed by walls/doors/etc.".
-    if (0 > first.z) return false;
-    if (const submap* const sm = MAPBUFFER.lookup_submap(first)) {
-        if (any<t_floor, t_floor_wax>(sm->terrain(second))) return false;
-        for (decltype(auto) delta : Direction::vector) {
-            const GPS_loc loc(*this + delta);
-            if (loc.first == first) {
-                if (any<t_floor, t_floor_wax>(sm->terrain(loc.second))) return false;
-            } else if (const submap* const sm2 = MAPBUFFER.lookup_submap(loc.first)) {
-                if (any<t_floor, t_floor_wax>(sm2->terrain(loc.second))) return false;
+    if (0 > _loc.first.z) return false;
+    if (!_sm) return true;    // If we haven't generated the submap yet, just assume we're outside.
+    // \todo This could be improved by using overmap terrain, e.g. houses are likely inside.
+    if (any<t_floor, t_floor_wax>(_sm->terrain(_loc.second))) return false;
+    for (decltype(auto) delta : Direction::vector) {
+        const GPS_loc loc(_loc + delta);
+        // Just discard the test if the submap wasn't generated yet.  We'll still have some context.
+        if (const submap* const sm = (loc.first == _loc.first) ? _sm : _resolve(loc.first)) {
+            if (any<t_floor, t_floor_wax>(sm->terrain(loc.second))) return false;
+        }
+    }
+    if (const auto veh = _loc.veh_at()) {
+        if (veh->first->is_inside(veh->second)) return false;
+    }
+    return true; // No guessing, we're outside.
+}
+
+std::vector<bool> map::outside_mask()
+{
+    const int span = SEE * my_MAPSIZE;
+    std::vector<bool> ret(span * span, false);
+    if (!grid[0] || 0 > grid[0]->toGPS(point(0, 0), Badge<map>()).first.z) return ret;
+
+    std::vector<bool> floored(span * span, false);
+    const auto nonant_ub = my_MAPSIZE * my_MAPSIZE;
+    for (int n = 0; n < nonant_ub; n++) {
+        const submap* const sm = grid[n];
+        if (!sm) continue;
+        const point origin = toScreen(reality_bubble_loc(n, point(0, 0)));
+        point pt;
+        for (pt.y = 0; pt.y < SEE; pt.y++) {
+            for (pt.x = 0; pt.x < SEE; pt.x++) {
+                if (any<t_floor, t_floor_wax>(sm->terrain(pt))) floored[(origin.x + pt.x) + (origin.y + pt.y) * span] = true;
             }
-            // Just discard the test if the submap wasn't generated yet.  We'll still have some context.
         }
-        if (const auto veh = veh_at()) {
-            if (veh->first->is_inside(veh->second)) return false;
+    }
+
+    point pt;
+    for (pt.y = 0; pt.y < span; pt.y++) {
+        for (pt.x = 0; pt.x < span; pt.x++) {
+            const auto pos = to(pt);
+            if (!pos || !grid[pos->first]) continue;
+            if (0 == pt.x || 0 == pt.y || span - 1 == pt.x || span - 1 == pt.y) {
+                ret[pt.x + pt.y * span] = toGPS(*pos).is_outside();  // neighbors off the bubble
+                continue;
+            }
+            bool roofed = false;
+            for (int dy = -1; dy <= 1 && !roofed; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    if (floored[(pt.x + dx) + (pt.y + dy) * span]) {
+                        roofed = true;
+                        break;
+                    }
+                }
+            }
+            if (roofed) continue;
+            if (const auto veh = veh_at(*pos)) {
+                if (veh->first->is_inside(veh->second)) continue;
+            }
+            ret[pt.x + pt.y * span] = true;
         }
-        return true; // No guessing, we're outside.
     }
-    return true;    // If we haven't generated the submap yet, just assume we're outside.
-    // \todo This could be improved by using overmap terrain, e.g. houses are likely inside.
+    return ret;
 }
 
 bool map::bash(int x, int y, int str, int *res)
@@ -1631,16 +1940,21 @@ void map::process_active_items()
     for(submap* const gr : grid) gr->process_active_items();
 }
 
+void map::touch(int turn)
+{
+    for (submap* const gr : grid) gr->touch(turn);
+}
+
 unsigned int GPS_loc::use_amount(int range, const itype_id type, int quantity, bool use_container)
 {
     const int start_qty = quantity;
+    GPS_cursor scan(*this);
     for (int radius = 0; radius <= range && quantity > 0; radius++) {
         const int ub = 8 * radius;
         int i = 0;
         do {
-            auto delta = zaimoni::gdi::Linf_border_sweep<point>(radius, i, 0, 0);
-            GPS_loc loc = *this + delta;
-            decltype(auto) items = loc.items_at();
+            scan.seek(zaimoni::gdi::Linf_border_sweep<point>(radius, i, 0, 0));
+            decltype(auto) items = scan.items_at();
             ptrdiff_t n = items.size();
             while (0 <= --n) {
                 auto& curit = items[n];
@@ -1670,13 +1984,13 @@ unsigned int GPS_loc::use_amount(int range, const itype_id type, int quantity, b
 unsigned int GPS_loc::use_charges(int range, const itype_id type, int quantity)
 {
     const int start_qty = quantity;
+    GPS_cursor scan(*this);
     for (int radius = 0; radius <= range && quantity > 0; radius++) {
         const int ub = 8 * radius;
         int i = 0;
         do {
-            auto delta = zaimoni::gdi::Linf_border_sweep<point>(radius, i, 0, 0);
-            GPS_loc loc = *this + delta;
-            decltype(auto) items = loc.items_at();
+            scan.seek(zaimoni::gdi::Linf_border_sweep<point>(radius, i, 0, 0));
+            decltype(auto) items = scan.items_at();
             ptrdiff_t n = items.size();
             while (0 <= --n) {
                 auto& curit = items[n];
@@ -1801,13 +2115,14 @@ void map::debug()
 void map::draw(WINDOW* w, const player& u, point center)
 {
  int light = u.sight_range();
+ tile_planes planes(*this, center - point(VIEW_CENTER), center + point(VIEW_CENTER));
  forall_do_inclusive(view_center_extent(), [&](point offset) {
         const point real(center + offset);
         const int dist = rl_dist(u.pos, real);
         const point draw_at(offset + point(VIEW_CENTER));
         if (dist > light) {
             mvwputch(w, draw_at.y, draw_at.x, (u.has_disease(DI_BOOMERED) ? c_magenta : c_dkgray), '#');
-        } else if (dist <= u.clairvoyance() || sees(u.pos, real, light))
+        } else if (dist <= u.clairvoyance() || sees(planes, u.pos, real, light))
             drawsq(w, u, real.x, real.y, false, true, center);
         else
             mvwputch(w, draw_at.y, draw_at.x, c_black, '#');
@@ -1998,7 +2313,9 @@ void map::drawsq(WINDOW* w, const player& u, GPS_loc dest, bool invert, bool sho
 based off code by Steve Register [arns@arns.freeservers.com]
 http://roguebasin.roguelikedevelopment.org/index.php?title=Simple_Line_of_Sight
 */
-std::optional<int> map::_BresenhamLine(int Fx, int Fy, int Tx, int Ty, int range, std::function<bool(reality_bubble_loc)> test) const
+// test(x, y) is responsible for bounds-checking
+template<class Test>
+static std::optional<int> _BresenhamLine(int Fx, int Fy, int Tx, int Ty, int range, Test test)
 {
     int dx = Tx - Fx;
     int dy = Ty - Fy;
@@ -2014,8 +2331,6 @@ std::optional<int> map::_BresenhamLine(int Fx, int Fy, int Tx, int Ty, int range
     int t = 0;
     int st;
 
-    decltype(to(x,y)) pos;
-
     if (ax > ay) { // Mostly-horizontal line
         st = signum(ay - (ax >> 1));
         // Doing it "backwards" prioritizes straight lines before diagonal.
@@ -2036,7 +2351,7 @@ std::optional<int> map::_BresenhamLine(int Fx, int Fy, int Tx, int Ty, int range
                     tc *= st;
                     return tc;
                 }
-            } while ((pos = to(x, y)) && test(*pos));
+            } while (test(x, y));
         }
         return std::nullopt;
     } else { // Same as above, for mostly-vertical lines
@@ -2056,26 +2371,42 @@ std::optional<int> map::_BresenhamLine(int Fx, int Fy, int Tx, int Ty, int range
                     tc *= st;
                     return tc;
                 }
-            } while ((pos = to(x, y)) && test(*pos));
+            } while (test(x, y));
         }
         return std::nullopt;
     }
     return std::nullopt; // Shouldn't ever be reached, but there it is.
 }
 
+template<class Test>
+std::optional<int> map::_BresenhamLine(int Fx, int Fy, int Tx, int Ty, int range, Test test) const
+{
+    return ::_BresenhamLine(Fx, Fy, Tx, Ty, range, [&](int x, int y) {
+        const auto pos = to(x, y);
+        return pos && test(*pos);
+    });
+}
+
 std::optional<int> map::sees(int Fx, int Fy, int Tx, int Ty, int range) const
 {
+  PROFILE_SCOPE("map::sees");
   return _BresenhamLine(Fx, Fy, Tx, Ty, range, [&](reality_bubble_loc pos) { return trans(pos); });
 }
 
+std::optional<int> map::sees(tile_planes& src, const point& F, const point& T, int range) const
+{
+    PROFILE_SCOPE("map::sees");
+    return ::_BresenhamLine(F.x, F.y, T.x, T.y, range, [&](int x, int y) { return src.trans(point(x, y)); });
+}
+
 std::optional<int> map::clear_path(int Fx, int Fy, int Tx, int Ty, int range, int cost_min, int cost_max) const
 {
     return _BresenhamLine(Fx, Fy, Tx, Ty, range, [&](reality_bubble_loc pos){ return is_between(cost_min, move_cost(pos), cost_max);});
 }
 
 // stub to enable building
-template<bool want_path=false>
-static std::conditional_t<want_path, std::optional<std::vector<GPS_loc> >, bool> _BresenhamLine(GPS_loc origin, tripoint delta, int range, std::function<bool(GPS_loc)> test)
+template<bool want_path=false, class Test>
+static std::conditional_t<want_path, std::optional<std::vector<GPS_loc> >, bool> _BresenhamLine(GPS_loc origin, tripoint delta, int range, Test test)
 {
 #if 0
     int dx = Tx - Fx;
@@ -2147,8 +2478,8 @@ static std::conditional_t<want_path, std::optional<std::vector<GPS_loc> >, bool>
     else return false;
 }
 
-template<bool want_path = false>
-static std::conditional_t<want_path, std::optional<std::vector<GPS_loc> >, bool> _BresenhamLine(GPS_loc origin, const point delta, int range, std::function<bool(GPS_loc)> test)
+template<bool want_path = false, class Test>
+static std::conditional_t<want_path, std::optional<std::vector<GPS_loc> >, bool> _BresenhamLine(GPS_loc origin, const point delta, int range, Test test)
 {
     if (0 <= range && Linf_dist(delta) > range) {	// Out of range!
         if constexpr (want_path) return std::nullopt;
@@ -2229,8 +2560,8 @@ static std::conditional_t<want_path, std::optional<std::vector<GPS_loc> >, bool>
     else return false;
 }
 
-template<bool want_path = false>
-static auto _BresenhamLine(GPS_loc origin, GPS_loc dest, int range, std::function<bool(GPS_loc)> test)
+template<bool want_path = false, class Test>
+static auto _BresenhamLine(GPS_loc origin, GPS_loc dest, int range, Test test)
 {
     auto delta = dest - origin;
     // \todo convert to std::visit so we have compile-time checking that all cases are handled
@@ -2251,6 +2582,7 @@ bool GPS_loc::can_see(const GPS_loc& dest, int range) const
 // Bash defaults to true.
 std::vector<point> map::route(int Fx, int Fy, int Tx, int Ty, bool bash) const
 {
+ PROFILE_SCOPE("map::route");
 /* TODO: If the origin or destination is out of bound, figure out the closest
  * in-bounds point and go to that, then to the real origin/destination.
  */
@@ -2290,6 +2622,8 @@ std::vector<point> map::route(int Fx, int Fy, int Tx, int Ty, bool bash) const
  if (endy > SEEY * my_MAPSIZE - 1)
   endy = SEEY * my_MAPSIZE - 1;
 
+ tile_planes planes(*this, point(startx, starty), point(endx, endy));
+
  list[Fx][Fy] = ASL_OPEN;
  open.push_back(point(Fx, Fy));
 
@@ -2310,12 +2644,12 @@ std::vector<point> map::route(int Fx, int Fy, int Tx, int Ty, bool bash) const
           done = true;
           parent[dest.x][dest.y] = open[index];
       } else if (dest.x >= startx && dest.x <= endx && dest.y >= starty && dest.y <= endy) {
-          const int mv_cost = move_cost(dest);
-          const bool can_destroy = bash && has_flag(bashable, dest);
+          const int mv_cost = planes.move_cost(dest);
+          const bool can_destroy = bash && planes.bashable(dest);
           if (0 < mv_cost || can_destroy) {
               decltype(auto) gcost = [&]() {
                   int new_g = gscore[open[index].x][open[index].y] + mv_cost;
-                  if (ter(dest) == t_door_c) new_g += 4;	// A turn to open it and a turn to move there
+                  if (planes.closed_door(dest)) new_g += 4;	// A turn to open it and a turn to move there
                   else if (0 == mv_cost && can_destroy) new_g += 18;	// Worst case scenario with damage penalty
                   return new_g;
               };
@@ -2488,15 +2822,15 @@ void map::shift(game *g, const point& world, const point& delta)
 // 0,0 1,0 2,0
 // 0,1 1,1 2,1
 // 0,2 1,2 2,2
-void map::saven(const tripoint& om_pos, unsigned int turn, const point& world, int gridx, int gridy)
+bool map::saven(const tripoint& om_pos, unsigned int turn, const point& world, int gridx, int gridy)
 {
  const int n = gridx + gridy * my_MAPSIZE;
 
- if (t_null == grid[n]->terrain(point(0))) return;
+ if (t_null == grid[n]->terrain(point(0))) return false;
  int abs_x = om_pos.x * OMAPX * 2 + world.x + gridx,
      abs_y = om_pos.y * OMAPY * 2 + world.y + gridy;
 
- MAPBUFFER.add_submap(abs_x, abs_y, om_pos.z, grid[n]);
+ return MAPBUFFER.add_submap(abs_x, abs_y, om_pos.z, grid[n]);
 }
 
 // worldx & worldy specify where in the world this is;
@@ -2510,9 +2844,12 @@ bool map::loadn(game *g, const point& world, int gridx, int gridy)
      absy = g->cur_om.pos.y * OMAPY * 2 + world.y + gridy,
      gridn = gridx + gridy * my_MAPSIZE;
  if (submap * const tmpsub = MAPBUFFER.lookup_submap(absx, absy, g->cur_om.pos.z)) {
+  tmpsub->catch_up(int(messages.turn));
   grid[gridn] = tmpsub;
+  _veh_grid.clear();
+  tmpsub->moving_vehicles(in_motion, Badge<map>());
  } else { // It doesn't exist; we must generate it!
-  map tmp_map;
+  tinymap tmp_map;
 // overx, overy is where in the overmap we need to pull data from
 // Each overmap square is two nonants; to prevent overlap, generate only at
 //  squares divisible by 2.
@@ -2530,9 +2867,12 @@ bool map::loadn(const tripoint& GPS, int gridx, int gridy)
 {
     const int gridn = gridx + gridy * my_MAPSIZE;
     if (submap* const tmpsub = MAPBUFFER.lookup_submap(GPS.x+gridx, GPS.y + gridy, GPS.z)) {
+        tmpsub->catch_up(int(messages.turn));
         grid[gridn] = tmpsub;
+        _veh_grid.clear();
+        tmpsub->moving_vehicles(in_motion, Badge<map>());
     } else { // It doesn't exist; we must generate it!
-        map tmp_map;
+        tinymap tmp_map;
         // overx, overy is where in the overmap we need to pull data from
         // Each overmap square is two nonants; to prevent overlap, generate only at
         //  squares divisible by 2.
@@ -2549,6 +2889,7 @@ bool map::loadn(const tripoint& GPS, int gridx, int gridy)
 void map::copy_grid(int to, int from)
 {
  grid[to] = grid[from];
+ _veh_grid.clear();
 }
 
 void submap::exec_spawns(const Badge<map>& auth)
@@ -9,6 +9,8 @@
 #include "ui.h"
 
 #include <functional>
+#include <map>
+#include <memory>
 #include <string>
 #include <optional>
 
@@ -21,6 +23,7 @@ class player;
 class monster;
 class overmap;
 struct submap;
+struct vehicle_obstacles;
 
 // We do not want to use the Curiously Recurring Template Pattern to deal with the submap grid
 class map
@@ -34,6 +37,7 @@ class map
 	 return ooao;
  }
  static std::vector <itype_id> items[num_itloc]; // Items at various map types
+ static std::vector <int> items_rarity_sum[num_itloc]; // running rarity totals of items, for weighted selection
  static map_extra _force_map_extra; // debugging assistant
  static point _force_map_extra_pos; // debugging assistant
 
@@ -81,7 +85,37 @@ class map
  int move_cost(const reality_bubble_loc& pos) const;
  bool trans(const point& pt) const; // Transparent?
  bool trans(const reality_bubble_loc& pos) const;
- std::optional<int> _BresenhamLine(int Fx, int Fy, int Tx, int Ty, int range, std::function<bool(reality_bubble_loc)> test) const;
+ template<class Test> std::optional<int> _BresenhamLine(int Fx, int Fy, int Tx, int Ty, int range, Test test) const;	// map.cpp only
+
+ // Flat per-tile memo of the properties hot loops (A*, line of sight) query repeatedly; each tile in [tl, br] is evaluated
+ // at most once.  Only valid while terrain, fields and vehicles are unchanged: build it for one computation, then discard.
+ class tile_planes {
+ public:
+	 tile_planes(const map& m, point tl, point br);	// inclusive corners, clipped to the map
+	 tile_planes(const tile_planes& src) = delete;
+	 tile_planes(tile_planes&& src) = default;
+	 ~tile_planes() = default;
+	 tile_planes& operator=(const tile_planes& src) = delete;
+	 tile_planes& operator=(tile_planes&& src) = delete;
+
+	 int move_cost(const point& pt);
+	 bool trans(const point& pt);	// off-map is opaque, as for line of sight
+	 bool bashable(const point& pt);
+	 bool closed_door(const point& pt);
+
+ private:
+	 enum : unsigned char { KNOWN_MOVE = 1, KNOWN_TRANS = 2, TRANS = 4, BASH = 8, DOOR = 16 };
+
+	 const map& _m;
+	 point _tl;
+	 int _w;
+	 int _h;
+	 std::vector<unsigned char> _move_cost;
+	 std::vector<unsigned char> _flags;
+
+	 int _index(const point& pt) const;	// -1 if not covered
+	 unsigned char _movement(int i, const point& pt);
+ };
  // (Fx, Fy) sees (Tx, Ty), within a range of (range)?
  // tc indicates the Bresenham line used to connect the two points, and may
  //  subsequently be used to form a path between them
@@ -89,6 +123,7 @@ class map
  std::optional<int> sees(const point& F, int Tx, int Ty, int range) const { return sees(F.x, F.y, Tx, Ty, range); };
  std::optional<int> sees(const point& F, const point& T, int range) const { return sees(F.x, F.y, T.x, T.y, range); };
  std::optional<int> sees(int Fx, int Fy, const point& T, int range) const { return sees(Fx, Fy, T.x, T.y, range); };
+ std::optional<int> sees(tile_planes& src, const point& F, const point& T, int range) const;
  // clear_path is the same idea, but uses cost_min <= move_cost <= cost_max
  std::optional<int> clear_path(int Fx, int Fy, int Tx, int Ty, int range, int cost_min, int cost_max) const;
 // route() generates an A* best path; if bash is true, we can bash through doors
@@ -118,6 +153,9 @@ class map
 // WARNING: not checking collisions!
  bool displace_vehicle(std::shared_ptr<vehicle> veh, const point& delta, bool test=false);
  void vehmove(game* g);          // Vehicle movement
+ void vehicle_started(const vehicle& veh);	// parked vehicles are not scheduled by vehmove until this is called
+ void reindex(vehicle& veh, const Badge<vehicle>& auth);	// veh's tiles may have changed
+ void unindex(const vehicle& veh, const Badge<vehicle>& auth);	// veh is leaving its submap
 // move water under wheels. true if moved
  bool displace_water(const point& pt);
 
@@ -189,8 +227,22 @@ class map
  bool has_flag(t_flag flag, const reality_bubble_loc& pos) const;
  bool is_destructable(int x, int y) const;        // checks terrain and vehicles
  bool is_destructable(const point& pt) const { return is_destructable(pt.x, pt.y); }
-
- std::vector<point> grep(const point& tl, const point& br, std::function<bool(point)> test);
+ // GPS_loc::is_outside for every tile of the reality bubble at once, indexed x + y * SEE * my_MAPSIZE.
+ // Terrain is one flat pass over the loaded submaps; only the bubble's rim consults MAPBUFFER for its neighbors.
+ std::vector<bool> outside_mask();
+
+ template<class F> std::vector<point> grep(const point& tl, const point& br, F&& test) {
+	 std::vector<point> ret;
+	 if (tl.x <= br.x && tl.y <= br.y) {
+		 point pt;
+		 for (pt.x = tl.x; pt.x <= br.x; pt.x++) {
+			 for (pt.y = tl.y; pt.y <= br.y; pt.y++) {
+				 if (test(pt)) ret.push_back(pt);
+			 }
+		 }
+	 }
+	 return ret;
+ }
 
  template<ter_id src, ter_id dest> void translate() { // Change all instances of $src->$dest
 	 static_assert(src != dest);
@@ -242,6 +294,7 @@ class map
  void add_item(const point& pt, item&& new_item) { return add_item(pt.x, pt.y, std::move(new_item)); }
  bool hard_landing(const point& pt, item&& thrown, player* p = nullptr); // for thrown objects
  void process_active_items();
+ void touch(int turn);	// record that the reality bubble is up to date; cf. submap::catch_up
 
 // Traps
  trap_id& tr_at(int x, int y);
@@ -299,7 +352,7 @@ class map
  static void init();
 
 protected:
- void saven(const tripoint& om_pos, unsigned int turn, const point& world, int gridx, int gridy);
+ bool saven(const tripoint& om_pos, unsigned int turn, const point& world, int gridx, int gridy);
  bool loadn(game *g, const point& world, int gridx, int gridy);
  bool loadn(const tripoint& GPS, int gridx, int gridy);
  void copy_grid(int to, int from);
@@ -315,8 +368,17 @@ protected:
 
  int my_MAPSIZE;
  std::vector<submap*> grid;
+ std::vector<std::weak_ptr<vehicle> > in_motion;	// vehmove's registry of vehicles with nonzero velocity
 
 private:
+	// (vehicle, external part) by screen tile.  Only the game's map keeps one: cleared when its own submap grid is
+	// reassigned and rebuilt on next use; otherwise updated one vehicle at a time through reindex/unindex.
+	std::vector<std::pair<vehicle*, int> > _veh_grid;
+	std::map<const vehicle*, std::vector<std::pair<int, int> > > _veh_cells;	// (_veh_grid entry, part) each vehicle covers, sorted by entry; includes entries an overlapping vehicle holds
+	void _rebuild_veh_grid();
+	void _index(vehicle& veh, const point& origin);
+	void _unindex(const vehicle& veh);
+
 	field& field_at(const reality_bubble_loc& src);
 	void remove_field(const reality_bubble_loc& src);
 
@@ -328,6 +390,7 @@ private:
 	trap_id tr_at(const reality_bubble_loc& src) const { return const_cast<map*>(this)->tr_at(src); }
 
 	computer* add_computer(const reality_bubble_loc& dest, std::string&& name, int security);
+	vehicle_obstacles obstacles_near(const vehicle& veh, const point& delta);	// vehmove broadphase
 	void _translate(ter_id from, ter_id to);	// error-checked backend for map::translate
 };
 
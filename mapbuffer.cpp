@@ -3,6 +3,7 @@
 #include "recent_msg.h"
 #include "saveload.h"
 #include "ios_file.h"
+#include "profile.hpp"
 #include <fstream>
 
 mapbuffer MAPBUFFER;
@@ -31,6 +32,7 @@ submap* mapbuffer::lookup_submap(const tripoint& src)
 
 void mapbuffer::save()
 {
+ PROFILE_SCOPE("mapbuffer::save");
  if (submaps.empty()) return;
 
  DECLARE_AND_ACID_OPEN(std::ofstream, fout, MAP_FILE, return;)
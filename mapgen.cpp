@@ -6,6 +6,7 @@
 #include "submap.h"
 #include "recent_msg.h"
 #include "om_cache.hpp"
+#include "profile.hpp"
 #include "Zaimoni.STL/Logging.h"
 #include "zero.h"
 #include "stl_typetraits_late.h"
@@ -116,13 +117,31 @@ static map_extra random_map_extra(const map_extras& embellishments)
 }
 
 submap::submap(int t0)
-: active_item_count(0), field_count(0), turn_last_touched(t0)
+: active_item_count(0), field_count(0), turn_last_touched(t0), rad_pending(0)
 {
 	memset(ter, 0, sizeof(ter));
 	memset(trp, 0, sizeof(trp));
 	memset(rad, 0, sizeof(rad));
 }
 
+// Scratch submaps mapgen created but did not keep; recycled rather than reallocated.
+static std::vector<std::unique_ptr<submap> > spare_submaps;
+
+static submap* new_submap(int turn)
+{
+    if (spare_submaps.empty()) return new submap(turn);
+    submap* const ret = spare_submaps.back().release();
+    spare_submaps.pop_back();
+    *ret = submap(turn);
+    return ret;
+}
+
+static void discard_submap(submap* sm)
+{
+    if (MAPSIZE * MAPSIZE > spare_submaps.size()) spare_submaps.emplace_back(sm);
+    else delete sm;
+}
+
 static std::pair<point, point> overmap_delta(int x, int y)
 {
     point over(x / 2, y / 2);
@@ -209,12 +228,14 @@ static bool connects_to(oter_id there)
 
 void map::generate(game *g, overmap *om, int x, int y)
 {
+  PROFILE_SCOPE("map::generate");
   const int turn = int(messages.turn);
 // First we have to create new submaps and initialize them to 0 all over
-// We create all the submaps, even if we're not a tinymap, so that map
-//  generation which overflows won't cause a crash.  At the bottom of this
-//  function, we save the upper-left 4 submaps, and delete the rest.
-  for (submap*& gr : grid) (gr = new submap(turn));
+// Only the upper-left 4 submaps are kept, so callers should generate on a tinymap.  Map generation
+//  which overflows that is clipped by the bounds-checked accessors.  At the bottom of this function,
+//  we save the upper-left 4 submaps, and recycle the rest.
+  for (submap*& gr : grid) (gr = new_submap(turn));
+  _veh_grid.clear();
 
  unsigned zones = 0;
  const auto physical = overmap_delta(x, y);
@@ -246,12 +267,12 @@ void map::generate(game *g, overmap *om, int x, int y)
 // And finally save used submaps and delete the rest.
  for (int i = 0; i < my_MAPSIZE; i++) {
   for (int j = 0; j < my_MAPSIZE; j++) {
-   if (i <= 1 && j <= 1)
-    saven(om->pos, turn, point(x, y), i, j); // should be ok w/out of bounds x,y
-   else
-    delete grid[i + j * my_MAPSIZE];
+   if (i > 1 || j > 1 || !saven(om->pos, turn, point(x, y), i, j)) // saven should be ok w/out of bounds x,y
+    discard_submap(grid[i + j * my_MAPSIZE]);
+   grid[i + j * my_MAPSIZE] = nullptr;
   }
  }
+ _veh_grid.clear();
 }
 
 // policy: make the caller responsible for the correct y range (historically non-strict upper bound is y0+5)
@@ -5778,6 +5799,14 @@ void map::post_process(game *g, unsigned zones)
 
 }
 
+// weighted by rarity; binary search of the running totals map::init builds
+static itype_id random_item(items_location loc)
+{
+ const auto& sum = map::items_rarity_sum[loc];
+ const auto n = std::lower_bound(sum.begin(), sum.end(), rng(1, sum.back())) - sum.begin();
+ return map::items[loc][n < sum.size() ? n : sum.size() - 1];
+}
+
 void map::place_items(items_location loc, int chance, int x1, int y1,
                       int x2, int y2, bool ongrass, int turn)
 {
@@ -5792,32 +5821,25 @@ void map::place_items(items_location loc, int chance, int x1, int y1,
   return;
  }
 
- int item_chance = 0;	// # of items
- for (const auto id : eligible) item_chance += item::types[id]->rarity;
-
  std::vector<std::pair<itype_id, point> > to_create;
+ std::vector<point> dest;	// valid terrain in the box; built on first use
 
- int selection;
- int px, py;
  while (rng(0, 99) < chance) {
-  int randnum = rng(1, item_chance);
-  selection = -1;
-  while (randnum > 0 && ++selection < eligible.size()-1) randnum -= item::types[eligible[selection]]->rarity;
-  int tries = 0;
-  do {
-   if (20 <= ++tries) {
-       if (!to_create.empty()) break;
-       return;
-   }
-   px = rng(x1, x2);
-   py = rng(y1, y2);
+  const auto selection = random_item(loc);
+  if (dest.empty()) {
+   for (int px = x1; px <= x2; px++) {
+    for (int py = y1; py <= y2; py++) {
 // Only place on valid terrain
-   const auto terrain = ter(px, py);
-   if (!ongrass && (t_dirt == terrain || t_grass == terrain)) continue;
-   const auto& t_data = ter_t::list[terrain];
-   if (t_data.movecost == 0 && !(t_data.flags & mfb(container))) continue;
-   to_create.push_back(std::pair(eligible[selection], point(px, py)));
-  } while (false);
+     const auto terrain = ter(px, py);
+     if (!ongrass && (t_dirt == terrain || t_grass == terrain)) continue;
+     const auto& t_data = ter_t::list[terrain];
+     if (t_data.movecost == 0 && !(t_data.flags & mfb(container))) continue;
+     dest.push_back(point(px, py));
+    }
+   }
+   if (dest.empty()) return;
+  }
+  to_create.push_back(std::pair(selection, dest[rng(0, dest.size() - 1)]));
  }
 
  if (to_create.empty()) return;
@@ -5852,16 +5874,7 @@ void map::place_items(items_location loc, int chance, int x1, int y1,
 
 void map::put_items_from(items_location loc, int num, int x, int y, int turn)
 {
- const auto& eligible = map::items[loc];
- int item_chance = 0;	// # of items
- for (const auto id : eligible) item_chance += item::types[id]->rarity;
-
- for (int i = 0; i < num; i++) {
-  int selection = -1;
-  int randnum = rng(1, item_chance);
-  while (randnum > 0 && ++selection < eligible.size() - 1) randnum -= item::types[eligible[selection]]->rarity;
-  add_item(x, y, item::types[eligible[selection]], turn);
- }
+ for (int i = 0; i < num; i++) add_item(x, y, item::types[random_item(loc)], turn);
 }
 
 void map::add_spawn(mon_id type, int count, int x, int y, bool friendly,
@@ -1,6 +1,7 @@
 #include "map.h"
 
 std::vector <itype_id> map::items[num_itloc]; // Items at various map types
+std::vector <int> map::items_rarity_sum[num_itloc];
 
 void map::init()
 {
@@ -688,4 +689,10 @@ void map::init()
 	itm_gasbomb_act, itm_smokebomb_act, itm_molotov_lit, itm_dynamite_act,
 	itm_mininuke_act, itm_UPS_on, itm_mp3_on, itm_c4armed
  };
+
+ for (int i = 0; i < num_itloc; i++) {
+  int total = 0;
+  items_rarity_sum[i].clear();
+  for (const auto id : items[i]) items_rarity_sum[i].push_back(total += item::types[id]->rarity);
+ }
 }
@@ -24,12 +24,19 @@ reality_bubble_loc mobile::bubblePos() const
 	return *ret;
 }
 
-void mobile::set_screenpos(point pt) { GPSpos = overmap::toGPS(pt); }
+void mobile::set_screenpos(point pt)
+{
+	const auto from = GPSpos;
+	GPSpos = overmap::toGPS(pt);
+	_moved(from);
+}
 
 void mobile::set_screenpos(const GPS_loc& loc)
 {
+	const auto from = GPSpos;
 	GPSpos = loc;
 	_set_screenpos();
+	_moved(from);
 }
 
 void mobile::knockback_from(const GPS_loc& loc)
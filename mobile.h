@@ -81,6 +81,7 @@ protected:
 
 	void set_screenpos(point pt); // could be public once synchronization with legacy point pos not needed
 	virtual void _set_screenpos() = 0;
+	virtual void _moved(const GPS_loc& from) {}	// after GPSpos changes through set_screenpos
 
 	/// <returns>true iff continuing</returns>
 	bool flung(int& flvel, GPS_loc& loc);
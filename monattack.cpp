@@ -13,6 +13,48 @@
 #include "Zaimoni.STL/GDI/box.hpp"
 #include "fragment.inc/rng_box.hpp"
 
+// Monsters by type, gathered at most once per turn and shared by every special attack that asks for that type
+// (creeper hubs for vines, breather hubs for breathers, zombies for upgrades), rather than each attack rescanning game::z.
+// Entries are game::z indexes, re-validated on use: monsters die and polymorph mid-turn, and ones spawned this turn are not listed.
+class monster_roster
+{
+    std::vector<std::vector<size_t> > _by_type;
+    int _turn;
+
+    monster_roster() : _by_type(num_monsters), _turn(-1) {}
+    ~monster_roster() = default;
+
+    void _update() {
+        if (int(messages.turn) == _turn) return;
+        _turn = messages.turn;
+        for (auto& x : _by_type) x.clear();
+        const auto g = game::active();
+        for (auto it = g->z.begin(); it != g->z.end(); ++it) {
+            if (!it->dead) _by_type[it->type->id].push_back(it.index());
+        }
+    }
+
+public:
+    monster_roster(const monster_roster& src) = delete;
+    monster_roster(monster_roster&& src) = delete;
+    monster_roster& operator=(const monster_roster& src) = delete;
+    monster_roster& operator=(monster_roster&& src) = delete;
+
+    static monster_roster& get() {
+        static monster_roster ooao;
+        return ooao;
+    }
+
+    template<class F>
+    void forall_do(mon_id type, F op) {
+        _update();
+        auto& z = game::active()->z;
+        for (const size_t i : _by_type[type]) {
+            if (auto _mon = z.at(i); _mon && !_mon->dead && type == _mon->type->id) op(*_mon);
+        }
+    }
+};
+
 void mattack::antqueen(monster& z)
 {
  const auto g = game::active();
@@ -163,7 +205,7 @@ void mattack::resurrect(game *g, monster *z)
  if (z->speed < z->type->speed / 2) return;	// We can only resurrect so many times!
 
 // Find all corpses that we can see within 4 tiles.
- static std::function<std::optional<point>(point)> ok = [&](point pt) {
+ auto ok = [&](point pt) -> std::optional<point> {
      auto pos(pt + z->pos);
      if (!g->is_empty(pos) || !g->m.sees(z->pos, pos, -1)) return std::optional<point>();
      for (auto& obj : g->m.i_at(pos)) {
@@ -398,7 +440,7 @@ void mattack::grow_vine(monster& z)
 
  point shift = rng(within_rldist<1>);
 
- static auto grow = [&](const point& delta) {
+ auto grow = [&](const point& delta) {
      auto delta2(shift + delta);
 
      if (-1 > delta2.x) delta2.x += 3;
@@ -455,7 +497,7 @@ void mattack::vine(monster& z)
 
  vine_attack attack(z);
  // Yes, we want to count ourselves as a neighbor.
- static auto hit_by_vine = [&](const point& delta) {
+ auto hit_by_vine = [&](const point& delta) {
      auto dest = z.GPSpos + delta;
      if (auto _mob = g->mob_at(dest)) std::visit(attack, *_mob);
      else if (dest.is_empty()) grow.push_back(dest);
@@ -471,8 +513,8 @@ void mattack::vine(monster& z)
 
 // Calculate distance from nearest hub, then check against that
  int dist_from_hub = INT_MAX;
- g->forall_do([&, gps=z.GPSpos](const monster& v) {
-     if (mon_creeper_hub == v.type->id) clamp_ub(dist_from_hub, rl_dist(gps, v.GPSpos));
+ monster_roster::get().forall_do(mon_creeper_hub, [&, gps=z.GPSpos](const monster& v) {
+     clamp_ub(dist_from_hub, rl_dist(gps, v.GPSpos));
  });
  if (!one_in(dist_from_hub)) return;
 
@@ -1347,8 +1389,8 @@ void mattack::upgrade(monster& z)
     const auto g = game::active();
     std::vector<monster*> targets;
 
-    g->forall_do([&, gps=z.GPSpos](monster& _mon) mutable {
-        if (mon_zombie == _mon.type->id && 5 >= rl_dist(gps, _mon.GPSpos)) targets.push_back(&_mon);
+    monster_roster::get().forall_do(mon_zombie, [&, gps=z.GPSpos](monster& _mon) {
+        if (5 >= rl_dist(gps, _mon.GPSpos)) targets.push_back(&_mon);
     });
     if (targets.empty()) return;
 
@@ -1379,15 +1421,9 @@ void mattack::breathe(monster& z)
 
  bool able = (z.type->id == mon_breather_hub);
  if (!able) {
-     static auto has_hub = [&](const point delta) {
-         auto loc = z.GPSpos + delta;
-         if (const auto m_at = game::active()->mon(loc)) {
-             if (mon_breather_hub == m_at->type->id) return true;
-         }
-         return false;
-     };
-
-     if (find_first(within_rldist<3>, has_hub)) able = true;
+     monster_roster::get().forall_do(mon_breather_hub, [&, gps = z.GPSpos](const monster& hub) {
+         if (3 >= rl_dist(gps, hub.GPSpos)) able = true;
+     });
  }
  if (!able) return;
 
@@ -137,7 +137,7 @@ void mdeath::worm(game *g, monster *z)
      messages.add("The %s splits in two!",
                    grammar::capitalize(z->desc(grammar::noun::role::subject, grammar::article::definite)).c_str());
 
- static std::function<std::optional<point>(point)> dest_clear = [&](point delta) {
+ auto dest_clear = [&](point delta) -> std::optional<point> {
      decltype(auto) test = z->pos + delta;
      return g->m.has_flag(diggable, test) && !g->mob_at(test) ? std::optional<point>(test) : std::nullopt;
  };
@@ -192,7 +192,7 @@ void mdeath::blobsplit(game *g, monster *z)
  if (seen) messages.add("The %s splits!", z_name->c_str());
  blob.hp = blob.speed;
 
- static std::function<std::optional<point>(point)> dest_clear = [&](point delta) {
+ auto dest_clear = [&](point delta) -> std::optional<point> {
      decltype(auto) test = z->pos + delta;
      return g->m.move_cost(test) > 0 && !g->mob_at(test) ? std::optional<point>(test) : std::nullopt;
  };
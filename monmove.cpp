@@ -7,9 +7,150 @@
 #include "recent_msg.h"
 
 #include <stdlib.h>
+#include <limits.h>
+#include <algorithm>
+#include <queue>
 
 #define MONSTER_FOLLOW_DIST 8
 
+// Dijkstra maps over the reality bubble: travel cost to a player or NPC, one field per target.  Shared by all
+// monsters chasing that target, so pursuit around obstacles is a table lookup.  A field is built when first asked for
+// and kept while its target stands still; once a turn it is re-checked against the step costs it was built from, and
+// rebuilt only if those changed.  Fields not asked for in a turn are dropped at the next.
+class pursuit_field
+{
+    static constexpr const int span = SEE * MAPSIZE;
+    static constexpr const int max_cost = 8 * SEE;   // about four submaps of open ground; beyond this the chase falls back to scent/sound
+    static constexpr const int reach = max_cost / 2; // cheapest step is 2
+    static constexpr const int unreached = INT_MAX;
+
+    struct field {
+        point source;
+        point tl;   // covers [tl, tl + (w, h))
+        int w;
+        int h;
+        std::vector<unsigned char> step;  // what cost was built from; 0 is impassable
+        std::vector<int> cost;
+        int checked;    // turn
+
+        int at(const point& pt) const {
+            const point rel(pt - tl);
+            if (0 > rel.x || w <= rel.x || 0 > rel.y || h <= rel.y) return unreached;
+            return cost[rel.x + rel.y * w];
+        }
+    };
+
+    std::vector<field> _fields;
+    int _turn;
+
+    pursuit_field() : _turn(-1) {}
+    ~pursuit_field() = default;
+public:
+    pursuit_field(const pursuit_field& src) = delete;
+    pursuit_field(pursuit_field&& src) = delete;
+    pursuit_field& operator=(const pursuit_field& src) = delete;
+    pursuit_field& operator=(pursuit_field&& src) = delete;
+
+    static pursuit_field& get() {
+        static pursuit_field ooao;
+        return ooao;
+    }
+
+    // steepest descent from origin toward target (a player or NPC position), over squares accepted by can_enter
+    template<class Test>
+    std::optional<point> next_step(const point& origin, const point& target, Test can_enter) {
+        const field& src = _field(target);
+        const int here = src.at(origin);
+        if (unreached == here) return std::nullopt;
+        std::optional<point> ret;
+        int best = here;
+        for (decltype(auto) dir : Direction::vector) {
+            const point test(origin + dir);
+            const int test_cost = src.at(test);
+            if (best <= test_cost) continue;
+            if (!can_enter(test)) continue;
+            best = test_cost;
+            ret = test;
+        }
+        return ret;
+    }
+
+private:
+    const field& _field(const point& target) {
+        const int now = int(messages.turn);
+        if (now != _turn) {
+            _fields.erase(std::remove_if(_fields.begin(), _fields.end(), [&](const field& x) { return x.checked < _turn; }), _fields.end());
+            _turn = now;
+        }
+        for (auto& x : _fields) {
+            if (target != x.source) continue;
+            if (now != x.checked) {
+                x.checked = now;
+                if (auto step = _steps(x.tl, x.w, x.h); x.step != step) {
+                    x.step = std::move(step);
+                    _build(x);
+                }
+            }
+            return x;
+        }
+        field& ret = _fields.emplace_back();
+        ret.source = target;
+        ret.tl = point(std::max(0, target.x - reach), std::max(0, target.y - reach));
+        ret.w = std::min(span, target.x + reach + 1) - ret.tl.x;
+        ret.h = std::min(span, target.y + reach + 1) - ret.tl.y;
+        ret.checked = now;
+        ret.step = _steps(ret.tl, ret.w, ret.h);
+        _build(ret);
+        return ret;
+    }
+
+    // same step costs as map::route
+    static std::vector<unsigned char> _steps(const point& tl, int w, int h) {
+        std::vector<unsigned char> ret(w * h, 0);
+        map::tile_planes planes(game::active()->m, tl, tl + point(w - 1, h - 1));
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                const point pt(tl.x + x, tl.y + y);
+                const int mv_cost = planes.move_cost(pt);
+                int step = mv_cost;
+                if (0 == mv_cost) {
+                    if (!planes.bashable(pt)) continue;
+                    step = 18;  // worst case scenario with damage penalty
+                } else if (planes.closed_door(pt)) step += 4;
+                ret[x + y * w] = step;
+            }
+        }
+        return ret;
+    }
+
+    static void _build(field& dest) {
+        dest.cost.assign(dest.w * dest.h, unreached);
+        using entry = std::pair<int, point>;
+        static constexpr const auto later = [](const entry& lhs, const entry& rhs) { return lhs.first > rhs.first; };
+        std::priority_queue<entry, std::vector<entry>, decltype(later)> frontier(later);
+        const point origin(dest.source - dest.tl);
+        dest.cost[origin.x + origin.y * dest.w] = 0;
+        frontier.push(entry(0, origin));
+
+        while (!frontier.empty()) {
+            const auto [dist, pt] = frontier.top();
+            frontier.pop();
+            if (dest.cost[pt.x + pt.y * dest.w] < dist) continue;  // stale
+            for (decltype(auto) dir : Direction::vector) {
+                const point next(pt + dir);
+                if (0 > next.x || dest.w <= next.x || 0 > next.y || dest.h <= next.y) continue;
+                const int i = next.x + next.y * dest.w;
+                if (0 == dest.step[i]) continue;
+                const int test = dist + dest.step[i];
+                if (max_cost < test) continue;
+                if (dest.cost[i] <= test) continue;
+                dest.cost[i] = test;
+                frontier.push(entry(test, next));
+            }
+        }
+    }
+};
+
 bool monster::can_move_to(const map &m, int x, int y) const
 {
  if (m.move_cost(x, y) == 0 &&
@@ -250,7 +391,16 @@ void monster::move(game *g)
   // CONCRETE PLANS - Most likely based on sight
   next = plans[0];
   moved = pos;
- } else if (has_flag(MF_SMELLS)) {
+ }
+ if (!moved && !plans.empty() && !is_fleeing(g->u) && g->survivor(plans.back())) {
+// We see a target, but the straight line to it is blocked (window, fence, ...).  Go around.
+  if (const auto dest = pursuit_field::get().next_step(pos, plans.back(), [&](const point& pt) { return can_sound_move_to(pt); })) {
+   if (update_next_loc(g->toGPS(*dest))) return;
+   next = *dest;
+   moved = pos;
+  }
+ }
+ if (!moved && has_flag(MF_SMELLS)) {
 // No sight... or our plans are invalid (e.g. moving through a transparent, but
 //  solid, square of terrain).  Fall back to smell if we have it.
   if (const auto dest = scent_move()) {
@@ -572,7 +722,7 @@ void monster::move_to(game *g, const point& pt)
  */
 void monster::stumble(game *g, const std::optional<point>& moved)
 {
- static std::function<std::optional<point>(point)> stumble_ok = [&](point delta) {
+ auto stumble_ok = [&](point delta) -> std::optional<point> {
      auto dest = pos + delta;
      if (point(0) == delta) return std::optional<point>(dest);
      if (moved && 2 <= rl_dist(dest, *moved)) return std::optional<point>(std::nullopt);
@@ -55,9 +55,23 @@ monster::monster(const mtype* t, GPS_loc origin) noexcept
 
 DEFINE_ACID_ASSIGN_W_MOVE(monster)
 
-void monster::screenpos_set(point pt) { GPSpos = overmap::toGPS(pos = pt); }
-void monster::screenpos_set(int x, int y) { GPSpos = overmap::toGPS(pos = point(x, y)); }
-void monster::screenpos_add(point delta) { GPSpos = overmap::toGPS(pos += delta); }
+void monster::screenpos_set(point pt)
+{
+    const auto from = GPSpos;
+    GPSpos = overmap::toGPS(pos = pt);
+    _moved(from);
+}
+
+void monster::screenpos_set(int x, int y) { screenpos_set(point(x, y)); }
+
+void monster::screenpos_add(point delta)
+{
+    const auto from = GPSpos;
+    GPSpos = overmap::toGPS(pos += delta);
+    _moved(from);
+}
+
+void monster::_moved(const GPS_loc& from) { game::active()->z_moved(*this, from.first); }	// keeps game::z_near current
 
 void monster::poly(const mtype *t)
 {
@@ -339,15 +353,15 @@ int monster::trigger_sum(const game* g, typename cataclysm::bitmap<N_MONSTER_TRI
     }
 
     if (triggers & mfb(MTRIG_PLAYER_CLOSE)) {
-        g->forall_do(std::function<void(const player&)>([=,this,&ret](const player& u) mutable {
+        g->forall_do([=,this,&ret](const player& u) mutable {
             if (rl_dist(GPSpos, u.GPSpos) <= 5) ret += 5;
-        }));
+        });
     }
 
     if (triggers & mfb(MTRIG_PLAYER_WEAK)) {	// C:Whales ignored NPCs here; implicit reality bubble lockdown here
-        g->forall_do(std::function<void(const player&)>([&ret](const player& u) mutable {
+        g->forall_do([&ret](const player& u) mutable {
             if (const int hp_percent = u.hp_percentage(); 70 >= hp_percent) ret += hp_percent / 10;
-        }));
+        });
     }
 
     const bool check_terrain = check_meat || check_fire;
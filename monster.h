@@ -221,6 +221,7 @@ private:
  bool can_sound_move_to(const point& pt) const;
 
  void _set_screenpos() override { if (auto pt = screen_pos()) pos = *pt; }
+ void _moved(const GPS_loc& from) override;
  bool handle_knockback_into_impassable(const GPS_loc& dest) override;
 
  void make_friendly(int duration);
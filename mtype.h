@@ -8,6 +8,9 @@
 #include "enum_json.h"
 #include "color.h"
 #include "c_bitmap.h"
+#if defined(PROFILE_TURNS) && !defined(SOCRATES_DAIMON)
+#include <chrono>
+#endif
 #include <map>
 #include <vector>
 
@@ -248,6 +251,14 @@ public:
  nc_color danger() const;
 #ifndef SOCRATES_DAIMON
  void do_special_attack(monster& viewpoint) const;
+#if defined(PROFILE_TURNS)
+ struct attack_timing {
+	 unsigned long calls = 0;
+	 std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::duration::zero();
+ };
+
+ static std::vector<std::pair<const mtype*, attack_timing> > special_attack_costs();	// this session, most expensive first
+#endif
 #endif
 
  static void init();
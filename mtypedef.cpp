@@ -6,8 +6,10 @@
 #endif
 #include "json.h"
 #include "game_aux.hpp"
+#include "profile.hpp"
 
 #include "Zaimoni.STL/Logging.h"
+#include <algorithm>
 
 std::vector<const mtype*> mtype::types;
 std::map<int, std::string> mtype::tiles;
@@ -124,11 +126,44 @@ int mtype::chunk_count() const
 }
 
 #ifndef SOCRATES_DAIMON
+#if defined(PROFILE_TURNS)
+// one profiler section per monster type, named on first use
+static std::vector<turn_profile::section*> special_attack_section(num_monsters, nullptr);
+static std::vector<std::string> special_attack_label(num_monsters);
+
+static turn_profile::section& special_attack_timing(const mtype& type)
+{
+	auto& ret = special_attack_section[type.id];
+	if (!ret) {
+		special_attack_label[type.id] = "special: " + type.name;
+		ret = &turn_profile::get().find(special_attack_label[type.id].c_str());
+	}
+	return *ret;
+}
+#endif
+
 void mtype::do_special_attack(monster& viewpoint) const
 {
+#if defined(PROFILE_TURNS)
+	turn_profile::timer timing(special_attack_timing(*this));
+#endif
 	if (special_attack) special_attack(viewpoint);
 	if (sp_attack) sp_attack(active_game(), &viewpoint);
 }
+
+#if defined(PROFILE_TURNS)
+std::vector<std::pair<const mtype*, mtype::attack_timing> > mtype::special_attack_costs()
+{
+	std::vector<std::pair<const mtype*, attack_timing> > ret;
+	for (decltype(auto) type : types) {
+		const auto src = special_attack_section[type->id];
+		if (!src || 0 >= src->calls + src->turn_calls) continue;
+		ret.push_back(std::pair(type, attack_timing{ src->calls + src->turn_calls, src->elapsed + src->turn_elapsed }));
+	}
+	std::sort(ret.begin(), ret.end(), [](const auto& lhs, const auto& rhs) { return lhs.second.elapsed > rhs.second.elapsed; });
+	return ret;
+}
+#endif
 #endif
 
 static const char* JSON_transcode[num_monsters] = {
@@ -257,6 +292,7 @@ void mtype::init()
 {
  int id = 0;
  mtype* working = nullptr;
+ types.reserve(num_monsters);
 // Null monster named "None".
  types.push_back(new mtype);
 
@@ -198,6 +198,7 @@ static void mutation_effect(player& p, pl_flag mut)
                     p.GPSpos.add(std::move(armor));
                 }
                 EraseAt(p.worn, i);
+                p.worn_changed();
                 i--;
                 break;
             }
@@ -219,6 +219,7 @@ End of cheatery */
  worn.push_back(item(item::types[itm_sneakers], 0, 'c'));
 // The near-sighted get to start with glasses.
  if (has_trait(PF_MYOPIC)) worn.push_back(item(item::types[itm_glasses_eye], 0, 'd'));
+ worn_changed();
 // Likewise, the asthmatic start with their medication.
  if (has_trait(PF_ASTHMA)) inv.push_back(item(item::types[itm_inhaler], 0, 'a' + worn.size()));
 // make sure we have no mutations
@@ -655,6 +655,7 @@ void npc::randomize(npc_class type)
  normalize();
  starting_weapon();
  worn = starting_clothes(type, male);
+ worn_changed();
  inv.clear();
  inv.add_stack(starting_inv(this, type));
 }
@@ -1026,6 +1027,7 @@ bool npc::wear_if_wanted(item it)
  }
  if (encumb_ok) {
   worn.push_back(it);
+  worn_changed();
   return true;
  }
 // Otherwise, maybe we should take off one or more items and replace them
@@ -1043,6 +1045,7 @@ bool npc::wear_if_wanted(item it)
 //  if (worn[removal[i]].value_to(this) < it.value_to(this)) {
    inv.push_back(worn[removal[i]]);
    worn.push_back(it);
+   worn_changed();
    return true;
   }
  }
@@ -1586,6 +1589,7 @@ int npc::danger_assessment() const
 		int total = 0;
 		const game* g;
 		int sightdist;
+		std::optional<map::tile_planes> los;	// shared by all the line of sight checks
 
 		_danger() = delete;
 		_danger(const npc& me, int total) : me(me), total(total), g(game::active()), sightdist(g->light_level(me.GPSpos)) {}
@@ -1596,7 +1600,9 @@ int npc::danger_assessment() const
 		~_danger() = default;
 
 		void operator()(const monster& _mon) {
-			if (g->m.sees(me.pos, _mon.pos, sightdist)) total += _mon.type->difficulty;
+			if (rl_dist(me.pos, _mon.pos) > sightdist) return;
+			if (!los) los.emplace(g->m, me.pos - point(sightdist), me.pos + point(sightdist));
+			if (g->m.sees(*los, me.pos, _mon.pos, sightdist)) total += _mon.type->difficulty;
 		}
 
 		// \todo should take range into account https://github.com/zaimoni/Cataclysm/issues/106
@@ -1620,14 +1626,13 @@ int npc::danger_assessment() const
 
 	_danger danger = { *this, 0 };
 	const auto g = game::active_const();
-	auto wrap_danger = function_relay(danger);
 
-	g->forall_do(std::function<void(const monster&)>(wrap_danger));
+	g->forall_do([&](const monster& z) { danger(z); });
 
 	danger.total /= 10;
 	if (danger.total <= 2) danger.total = -10 + 5 * danger.total;	// Low danger if no monsters around
 
-	g->forall_do(std::function<void(const player&)>(wrap_danger));
+	g->forall_do([&](const player& u) { danger(u); });
 
  for (int i = 0; i < num_hp_parts; i++) {
 	 if (i == hp_head || i == hp_torso) {
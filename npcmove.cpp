@@ -458,9 +458,17 @@ std::tuple<std::optional<std::variant<monster*, npc*, pc*> >, int, int> npc::cho
 		if (!std::visit(player::can_see(*this), *defend_u)) defend_u = std::nullopt;
 	}
 	int highest_priority = 0;
+	const auto g = game::active();
+	std::optional<map::tile_planes> los;	// shared by all the line of sight checks below
 
-	game::active()->forall_do([&](monster& mon) mutable {
-		if (!see(mon)) return;
+	g->forall_do([&](monster& mon) mutable {
+		int range;
+		if (const auto seen = see_without_LOS(mon, range)) {
+			if (!*seen) return;
+		} else {
+			if (!los) los.emplace(g->m, pos - point(range), pos + point(range));
+			if (!g->m.sees(*los, pos, mon.pos, range)) return;
+		}
 
 		int distance = (mobile::mp_turn * rl_dist(GPSpos, mon.GPSpos)) / mon.speed;
 		double hp_percent = double(mon.type->hp - mon.hp) / mon.type->hp;
@@ -1655,7 +1663,7 @@ tail_recurse:
 					return _mob;
 				};
 
-				if (auto better_target = find_first(confident, std::function(safe_throw))) {
+				if (auto better_target = find_first(confident, safe_throw)) {
 					target = *better_target;
 					goto tail_recurse;
 				}
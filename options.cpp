@@ -63,6 +63,8 @@ static constexpr const char* JSON_key(option_key opt)	// \todo micro-optimize th
 	case OPT_SAFEMODE: return "safe mode";
 	case OPT_AUTOSAFEMODE: return "auto safe mode";
 	case OPT_NPCS: return "NPCs";
+	case OPT_NO_ANIMATION: return "no animation";
+	case OPT_MESSAGE_LOG: return "message log";
 	case OPT_LOAD_TILES: return "load tiles";
 	case OPT_FONT_HEIGHT: return "font height";
 	case OPT_EXTRA_MARGIN: return "extra bottom-right margin";
@@ -205,6 +207,8 @@ const char* option_name(option_key key)
   case OPT_SAFEMODE:		return "Safemode on by default";
   case OPT_AUTOSAFEMODE:	return "Auto-Safemode on by default";
   case OPT_NPCS:			return "Generate NPCs";
+  case OPT_NO_ANIMATION:	return "No explosion/gunfire animation";
+  case OPT_MESSAGE_LOG:		return "Log messages to save/messages.log";
   case OPT_LOAD_TILES:		return "use tileset (requires restart)";
   case OPT_FONT_HEIGHT:		return "Font height (requires restart)";
   case OPT_EXTRA_MARGIN:	return "Extra bottom-right margin (requires restart)";
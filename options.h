@@ -26,6 +26,8 @@ OPT_SNAP_TO_TARGET, // game::firing snaps to target
 OPT_SAFEMODE, // Safemode on by default?
 OPT_AUTOSAFEMODE, // Autosafemode on by default?
 OPT_NPCS,	// NPCs generated in game world
+OPT_NO_ANIMATION,	// skip explosion and gunfire animation
+OPT_MESSAGE_LOG,	// append all messages to save/messages.log
 OPT_LOAD_TILES,	// use tileset
 OPT_FONT_HEIGHT,	// font height (ASCII)
 OPT_EXTRA_MARGIN,	// correction to margin to avoid clipping text
@@ -13,6 +13,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include <math.h>
+#include <limits.h>
 
 GPS_loc overmap::toGPS(const point& screen_pos) { return game::active()->toGPS(screen_pos); }
 
@@ -2768,28 +2769,77 @@ to your designated evacuation point."));
  }
 }
 
+// Overmap files are binary, each led by a tag that cannot start a legacy (all-printable) file.
+// Terrain is run-length encoded as (code, 16-bit little-endian run) pairs in row-major order, followed by the JSON data.
+// The seen plane is bit-packed in row-major order, low bit first, followed by the notes.
+// Legacy text files are still read, and are rewritten in the current format on the next save.
+static constexpr const char OM_TERRAIN_TAG[] = "\x01OMT1";
+static constexpr const char OM_SEEN_TAG[] = "\x01OMS1";
+static constexpr const int OM_SEEN_BYTES = (OMAPX * OMAPY + CHAR_BIT - 1) / CHAR_BIT;
+static_assert(OMAPX * OMAPY <= 0xFFFF, "terrain run length must fit in 16 bits");
+
+static bool read_tag(std::istream& is, const char* const tag)
+{
+    if (tag[0] != is.peek()) return false;
+    const size_t len = strlen(tag);
+    std::string test(len, '\0');
+    is.read(test.data(), len);
+    return test == tag;
+}
+
+static void write_u16(std::ostream& os, unsigned int src)
+{
+    os.put(char(src & 0xFF));
+    os.put(char((src >> 8) & 0xFF));
+}
+
+static int read_u16(std::istream& is)
+{
+    const int lo = is.get();
+    const int hi = is.get();
+    return (0 > lo || 0 > hi) ? -1 : lo | (hi << 8);
+}
+
 void overmap::save(const std::string& name, int x, int y, int z) const
 {
  std::ostringstream plrfilename, terfilename;
  plrfilename << "save/" << name << ".seen." << x << "." << y << "." << z;
  terfilename << "save/o." << x << "." << y << "." << z;
 
- std::ofstream fout(plrfilename.str().c_str());
- for (int j = 0; j < OMAPY; j++) {	// \todo good candidate for uuencoding
+ std::ofstream fout(plrfilename.str().c_str(), std::ios_base::binary);
+ fout << OM_SEEN_TAG;
+ {
+ std::string packed(OM_SEEN_BYTES, '\0');
+ int n = 0;
+ for (int j = 0; j < OMAPY; j++) {
   for (int i = 0; i < OMAPX; i++) {
-   if (seen(i, j))
-    fout << "1";
-   else
-    fout << "0";
+   if (seen(i, j)) packed[n / CHAR_BIT] |= char(1 << (n % CHAR_BIT));
+   n++;
   }
-  fout << std::endl;
+ }
+ fout.write(packed.data(), packed.size());
  }
  for(const auto& n : notes) fout << "N " << n << std::endl;
  fout.close();
- fout.open(terfilename.str().c_str(), std::ios_base::trunc);
+ fout.open(terfilename.str().c_str(), std::ios_base::trunc | std::ios_base::binary);
+ fout << OM_TERRAIN_TAG;
+ {
+ oter_id run_ter = ter(0, 0);
+ unsigned int run = 0;
  for (int j = 0; j < OMAPY; j++) {
-  for (int i = 0; i < OMAPX; i++)
-   fout << char(int(ter(i, j)) + 32);
+  for (int i = 0; i < OMAPX; i++) {
+   const auto code = ter(i, j);
+   if (code != run_ter) {
+    fout.put(char(run_ter));
+    write_u16(fout, run);
+    run_ter = code;
+    run = 0;
+   }
+   run++;
+  }
+ }
+ fout.put(char(run_ter));
+ write_u16(fout, run);
  }
  fout << std::endl;
 
@@ -2826,20 +2876,35 @@ overmap::overmap(game* g, int x, int y, int z)
  plrfilename << "save/" << g->u.name << ".seen." << pos.x << "." << pos.y << "." << pos.z;
 
  const auto terfilename(terrain_filename(pos));
- std::ifstream fin(terfilename.c_str());
+ std::ifstream fin(terfilename.c_str(), std::ios_base::binary);
  if (fin.is_open()) {
+  auto bad_ter = [&](int ter_code) {
+      // \todo: some sort of best-effort repair process?
+      debuglog("Loaded bad ter!  %s; ter %d", terfilename.c_str(), ter_code);
+      debugmsg("Loaded bad ter!  %s; ter %d", terfilename.c_str(), ter_code); // UI (in case it lasts long enough)
+      throw std::runtime_error("terrain file damaged, not attempting automatic repair.");
+  };
+  if (read_tag(fin, OM_TERRAIN_TAG)) {
+   int n = 0;
+   while (n < OMAPX * OMAPY) {
+    const auto ter_code = fin.get();
+    auto run = read_u16(fin);
+    if (!is_between(0, ter_code, num_ter_types - 1)) bad_ter(ter_code);
+    if (0 >= run || OMAPX * OMAPY - n < run) bad_ter(ter_code);
+    while (0 < run--) {
+     ter(n % OMAPX, n / OMAPX) = oter_id(ter_code);
+     n++;
+    }
+   }
+  } else {	// pre-binary format: one printable char per tile
   for (int j = 0; j < OMAPY; j++) {
    for (int i = 0; i < OMAPX; i++) {
 	const auto ter_code = fin.get() - 32;
-    // \todo: some sort of best-effort repair process?
-    if (!is_between(0, ter_code, num_ter_types - 1)) {
-        debuglog("Loaded bad ter!  %s; ter %d", terfilename.c_str(), ter_code);
-        debugmsg("Loaded bad ter!  %s; ter %d", terfilename.c_str(), ter_code); // UI (in case it lasts long enough)
-        throw std::runtime_error("terrain file damaged, not attempting automatic repair.");
-    }
+    if (!is_between(0, ter_code, num_ter_types - 1)) bad_ter(ter_code);
     ter(i, j) = oter_id(ter_code);
    }
   }
+  }
   if ('{' != (fin >> std::ws).peek()) {
       debuglog("Pre-V0.2.0 format?");
       debugmsg("Pre-V0.2.0 format?"); // UI (in case it lasts long enough)
@@ -2863,14 +2928,26 @@ overmap::overmap(game* g, int x, int y, int z)
 
 // Private/per-character data
   fin.close();
-  fin.open(plrfilename.str().c_str());
+  fin.open(plrfilename.str().c_str(), std::ios_base::binary);
   if (fin.is_open()) {	// Load private seen data
+   if (read_tag(fin, OM_SEEN_TAG)) {
+    std::string packed(OM_SEEN_BYTES, '\0');
+    fin.read(packed.data(), packed.size());
+    int n = 0;
+    for (int j = 0; j < OMAPY; j++) {
+     for (int i = 0; i < OMAPX; i++) {
+      seen(i, j) = packed[n / CHAR_BIT] & (1 << (n % CHAR_BIT));
+      n++;
+     }
+    }
+   } else {	// pre-binary format: one '0'/'1' per tile, one line per row
    for (int j = 0; j < OMAPY; j++) {
     for (int i = 0; i < OMAPX; i++) {
      seen(i, j) = (fin.get() == '1');
     }
 	fin >> std::ws;
    }
+   }
    while (fin >> datatype) {	// Load private notes
     if (datatype == 'N') notes.push_back(om_note(fin));
    }
@@ -76,6 +76,7 @@ item pc::i_rem(char let)
         if (worn[i].invlet == let) {
             tmp = std::move(worn[i]);
             EraseAt(worn, i);
+            worn_changed();
             return tmp;
         }
     }
@@ -925,9 +926,14 @@ std::vector<std::pair<const mtype*, int> > pc::summarize_kills()
 void pc::target_dead(int deceased)
 {
     if (target == deceased) target = -1;
-    else if (target > deceased) {
-        if (0 <= deceased) target--;
-    } else {
-        if (-2 > deceased) target++;    // cf. TARGET_PLAYER/npcmove.cpp
-    }
+    else if (target < deceased && -2 > deceased) target++;    // cf. TARGET_PLAYER/npcmove.cpp
+    // game::z does not renumber on erase
+}
+
+int pc::renumber_target(const std::vector<size_t>& remap)
+{
+    const int ret = target;
+    if (0 > target) return ret;
+    target = (remap.size() > size_t(target) && remap.size() > remap[target]) ? remap[target] : -1;
+    return ret;
 }
@@ -79,6 +79,7 @@ public:
 	void record_kill(const monster& m) override;
 	std::vector<std::pair<const mtype*, int> > summarize_kills();
 	void target_dead(int deceased);
+	int renumber_target(const std::vector<size_t>& remap);	// for saving game::z densely; returns the previous target
 	void set_target(int whom) { target = whom; }
 	bool is_target(int whom) const { return target == whom; }
 	void validate_target(std::function<bool(int)> ok) { if (!ok(target)) target = -1; }
@@ -550,14 +550,17 @@ void dis_effect(game* g, player& p, disease& dis)
         for (int i = 0; i < p.worn.size(); i++) {
             if (p.worn[i].made_of(VEGGY) || p.worn[i].made_of(PAPER)) {  // \todo V0.2.3+ want to handle wood here but having it auto-destruct doesn't seem reasonable
                 EraseAt(p.worn, i);
+                p.worn_changed();
                 i--;
             }
             else if ((p.worn[i].made_of(COTTON) || p.worn[i].made_of(WOOL)) && one_in(10)) {
                 EraseAt(p.worn, i);
+                p.worn_changed();
                 i--;
             }
             else if (p.worn[i].made_of(PLASTIC) && one_in(50)) {	// \todo V0.2.1+ thermoplastic might melt on the way which also causes damage
                 EraseAt(p.worn, i);
+                p.worn_changed();
                 i--;
             }
         }
@@ -1528,7 +1531,7 @@ player::player()
   power_level(0),max_power_level(0),hunger(0),thirst(0),fatigue(0),health(0),
   underwater(false),oxygen(0),recoil(0),driving_recoil(0),scent(500),
   stim(0),pain(0),pkill(0),radiation(0),cash(0),xp_pool(0),inv_sorted(true),
-  last_item(itm_null),style_selected(itm_null),weapon(item::null),dodges_left(1),blocks_left(1)
+  last_item(itm_null),style_selected(itm_null),weapon(item::null),dodges_left(1),blocks_left(1),_stale(STALE_ALL)
 {
  for (int i = 0; i < num_skill_types; i++) {
   sklevel[i] = 0;
@@ -2896,16 +2899,53 @@ const char* player::interpret_trait(const std::pair<pl_flag, const char*>* origi
 }
 
 
+void player::_refresh(unsigned char which) const
+{
+ which &= _stale;
+ if (which & STALE_BIONICS) {
+  _bionics_installed.reset();
+  _bionics_powered.reset();
+  for (const auto& bio : my_bionics) {
+   if (_bionics_installed[bio.id]) continue;	// first one wins, as for the old linear scans
+   _bionics_installed.set(bio.id);
+   if (bio.powered) _bionics_powered.set(bio.id);
+  }
+ }
+ if (which & STALE_DISEASES) {
+  _diseases.reset();
+  for (decltype(auto) ill : illness) _diseases.set(ill.type);
+ }
+ if (which & STALE_WORN) {
+  _worn_types.clear();
+  for (const auto& obj : worn) {
+   const int id = obj.type->id;
+   if (_worn_types.size() <= id) _worn_types.resize(id + 1, false);
+   _worn_types[id] = true;
+  }
+ }
+ _stale &= ~which;
+}
+
 bool player::has_bionic(bionic_id b) const
 {
- for (const auto& bionic : my_bionics) if (bionic.id == b) return true;
- return false;
+ _refresh(STALE_BIONICS);
+#ifndef NDEBUG
+ bool slow = false;
+ for (const auto& bionic : my_bionics) if (bionic.id == b) { slow = true; break; }
+ assert(slow == _bionics_installed[b]);
+#endif
+ return _bionics_installed[b];
 }
 
 bool player::has_active_bionic(bionic_id b) const
 {
- for (const auto& bionic : my_bionics) if (bionic.id == b) return bionic.powered;
- return false;
+ _refresh(STALE_BIONICS);
+#ifndef NDEBUG
+ bool slow = false;
+ for (const auto& bionic : my_bionics) if (bionic.id == b) { slow = bionic.powered; break; }
+ assert(slow == _bionics_powered[b]);
+#endif
+ return _bionics_powered[b];
 }
 
 void player::add_bionic(bionic_id b)
@@ -2914,6 +2954,7 @@ void player::add_bionic(bionic_id b)
 
  char newinv = my_bionics.empty() ? 'a' : my_bionics.back().invlet+1;
  my_bionics.push_back(bionic(b, newinv));
+ bionics_changed();
 }
 
 void player::charge_power(int amount)
@@ -2979,16 +3020,24 @@ int player::clairvoyance() const
  return 0;
 }
 
-bool player::see(const monster& mon) const
+std::optional<bool> player::see_without_LOS(const monster& mon, int& range) const
 {
     int dist = rl_dist(GPSpos, mon.GPSpos);
     if (dist <= seismic_range()) return true;
     if (mon.has_flag(MF_DIGS) && !has_active_bionic(bio_ground_sonar) && dist > 1)
         return false;	// Can't see digging monsters until we're right next to them
-    const auto range = sight_range();
+    range = sight_range();
     if (const auto clairvoyant = clairvoyance()) {
         if (dist <= clamped_lb(range, clairvoyant)) return true;
     }
+    if (dist > range) return false;
+    return std::nullopt;
+}
+
+bool player::see(const monster& mon) const
+{
+    int range;
+    if (const auto ret = see_without_LOS(mon, range)) return *ret;
     return (bool)game::active()->m.sees(pos, mon.pos, range);
 }
 
@@ -3598,6 +3647,7 @@ void player::add_disease(dis_type type, int duration, int intensity, int max_int
 	messages.add(describe(type));
  }
  illness.emplace_back(type, duration, intensity);
+ _stale |= STALE_DISEASES;
 }
 
 bool player::rem_disease(dis_type type)
@@ -3610,6 +3660,7 @@ bool player::rem_disease(dis_type type)
             ret = true;
         }
     }
+    if (ret) _stale |= STALE_DISEASES;
     return ret;
 }
 
@@ -3625,6 +3676,7 @@ bool player::rem_disease(std::function<bool(disease&)> op)
             ret = true;
         }
     }
+    if (ret) _stale |= STALE_DISEASES;
     return ret;
 }
 
@@ -3640,8 +3692,13 @@ bool player::do_foreach(std::function<bool(const disease&)> op) const {
 
 bool player::has_disease(dis_type type) const
 {
- for (decltype(auto) ill : illness) if (ill.type == type) return true;
- return false;
+ _refresh(STALE_DISEASES);
+#ifndef NDEBUG
+ bool slow = false;
+ for (decltype(auto) ill : illness) if (ill.type == type) { slow = true; break; }
+ assert(slow == _diseases[type]);
+#endif
+ return _diseases[type];
 }
 
 int player::disease_level(dis_type type) const
@@ -3746,7 +3803,10 @@ void player::suffer(game *g)
  while (0 <= --_i) {
      decltype(auto) ill = illness[_i];
      if (MIN_DISEASE_AGE > --ill.duration) ill.duration = MIN_DISEASE_AGE; // Cap permanent disease age
-     else if (0 == ill.duration) EraseAt(illness, _i);
+     else if (0 == ill.duration) {
+         EraseAt(illness, _i);
+         _stale |= STALE_DISEASES;
+     }
  }
  if (!has_disease(DI_SLEEP)) {
   const int timer = has_trait(PF_ADDICTIVE) ? -HOURS(6)-MINUTES(40) : -HOURS(6);
@@ -4481,6 +4541,7 @@ bool player::remove_discard(const item_spec& it)
         auto worn_at = -(2 + it.second);
         assert(it.first == &worn[worn_at]);
         EraseAt(worn, worn_at);
+        worn_changed();
         return true;
     }
     return false;
@@ -4574,10 +4635,14 @@ item* player::pick_usb()
 
 bool player::is_wearing(itype_id it) const
 {
- for (const auto& obj : worn) {
-  if (obj.type->id == it) return true;
- }
- return false;
+ _refresh(STALE_WORN);
+ const bool ret = it < _worn_types.size() && _worn_types[it];
+#ifndef NDEBUG
+ bool slow = false;
+ for (const auto& obj : worn) if (obj.type->id == it) { slow = true; break; }
+ assert(slow == ret);
+#endif
+ return ret;
 }
 
 bool player::has_artifact_with(art_effect_passive effect) const
@@ -5029,6 +5094,7 @@ bool player::wear_item(const item& to_wear)
  moves -= 7 * (mobile::mp_turn / 2); // \todo? Make this variable
  last_item = itype_id(to_wear.type->id);
  worn.push_back(to_wear);
+ worn_changed();
  if (!is_npc()) {
      for (body_part i = bp_head; i < num_bp; i = body_part(i + 1)) {
          if (armor->covers & mfb(i) && encumb(i) >= 4)
@@ -5057,10 +5123,12 @@ bool player::take_off(int i)
         inv.push_back(std::move(it));
         inv_sorted = false;
         EraseAt(worn, i);
+        worn_changed();
         return true;
     case -1:
         GPSpos.add(std::move(it));
         EraseAt(worn, i);
+        worn_changed();
         return true;
     default: return false;
     }
@@ -5380,6 +5448,7 @@ void player::absorb(body_part bp, int &dam, int &cut)
    if (worn[i].damage >= 5) {
     if_visible_message(is_gone, is_gone);
     EraseAt(worn, i);
+    worn_changed();
    }
   }
  }
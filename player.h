@@ -11,6 +11,7 @@
 #include "pldata.h"
 #include "zero.h"
 #include <functional>
+#include <bitset>
 
 enum art_effect_passive;
 enum craft_cat : int;
@@ -111,6 +112,7 @@ public:
  // bionics
  bool has_bionic(bionic_id b) const;
  bool has_active_bionic(bionic_id b) const;
+ void bionics_changed() { _stale |= STALE_BIONICS; }	// call after editing my_bionics directly
  void add_bionic(bionic_id b);
  void charge_power(int amount);
  void activate_bionic(int b); // V 0.2.1 extend to NPCs
@@ -126,6 +128,7 @@ public:
  unsigned int sight_range() const; // uses light level for our GPSpos
  unsigned int overmap_sight_range() const;
  bool see(const monster& mon) const;
+ std::optional<bool> see_without_LOS(const monster& mon, int& range) const; // if no answer, see(mon) is line of sight within range
  std::optional<int> see(const player& u) const;
  std::optional<int> see(const GPS_loc& pt) const;
  std::optional<int> see(const point& pt) const;
@@ -313,6 +316,7 @@ public:
  std::optional<int> butcher_factor() const;	// Automatically picks our best butchering tool
  item* pick_usb(); // Pick a usb drive, interactively if it matters
  bool is_wearing(itype_id it) const;	// Are we wearing a specific itype?
+ void worn_changed() { _stale |= STALE_WORN; }	// call after editing worn directly
  bool has_artifact_with(art_effect_passive effect) const;
 
 // has_amount works ONLY for quantity.
@@ -467,6 +471,15 @@ private:
  int blocks_left;
  std::vector <disease> illness;
 
+ // derived state for the per-turn has_bionic/has_active_bionic/has_disease/is_wearing queries; rebuilt on demand
+ enum { STALE_BIONICS = 1, STALE_DISEASES = 2, STALE_WORN = 4, STALE_ALL = 7 };
+ mutable unsigned char _stale;
+ mutable std::bitset<max_bio> _bionics_installed;
+ mutable std::bitset<max_bio> _bionics_powered;
+ mutable std::bitset<DI_CATCH_UP + 1> _diseases;
+ mutable std::vector<bool> _worn_types;	// indexed by itype_id
+ void _refresh(unsigned char which) const;
+
  void _set_screenpos() override { if (auto pt = screen_pos()) pos = *pt; }
  bool handle_knockback_into_impassable(const GPS_loc& dest) override;
  virtual void consume(item& food) = 0;
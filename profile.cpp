@@ -0,0 +1,102 @@
+#include "profile.hpp"
+
+#if defined(PROFILE_TURNS) && !defined(SOCRATES_DAIMON)
+#include <algorithm>
+#include <string.h>
+
+#define TRACE_FILE "save/profile.csv"
+#define SUMMARY_FILE "save/profile.json"
+
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+static double _ms(steady_clock::duration src) { return duration<double, std::milli>(src).count(); }
+
+turn_profile& turn_profile::get()
+{
+	static turn_profile ooao;
+	return ooao;
+}
+
+turn_profile::section& turn_profile::find(const char* name)
+{
+	for (auto& x : _sections) if (!strcmp(x.name, name)) return x;
+	return _sections.emplace_back(section{ name, 0, steady_clock::duration::zero(), 0, steady_clock::duration::zero(),
+		steady_clock::duration::zero(), steady_clock::duration::zero() });
+}
+
+void turn_profile::end_turn(int turn)
+{
+	_turns++;
+	for (auto& x : _sections) {
+		if (_trace.is_open() && 0 < x.turn_calls) {
+			_trace << turn << ',' << x.name << ',' << x.turn_calls << ','
+				<< std::chrono::duration_cast<std::chrono::microseconds>(x.turn_elapsed).count() << '\n';
+		}
+		x.calls += x.turn_calls;
+		x.elapsed += x.turn_elapsed;
+		x.last_turn = x.turn_elapsed;
+		if (x.worst_turn < x.turn_elapsed) x.worst_turn = x.turn_elapsed;
+		x.turn_calls = 0;
+		x.turn_elapsed = steady_clock::duration::zero();
+	}
+}
+
+void turn_profile::reset()
+{
+	_turns = 0;
+	for (auto& x : _sections) {
+		x.calls = 0;
+		x.elapsed = steady_clock::duration::zero();
+		x.last_turn = steady_clock::duration::zero();
+		x.worst_turn = steady_clock::duration::zero();
+	}
+}
+
+bool turn_profile::trace(bool on)
+{
+	if (!on) {
+		if (_trace.is_open()) _trace.close();
+		return true;
+	}
+	if (_trace.is_open()) return true;
+	_trace.open(TRACE_FILE, std::ios::app);
+	if (!_trace) {
+		_trace.close();
+		return false;
+	}
+	if (0 == _trace.tellp()) _trace << "turn,section,calls,microseconds\n";
+	return true;
+}
+
+bool turn_profile::write_json() const
+{
+	std::ofstream fout(SUMMARY_FILE);
+	if (!fout) return false;
+	fout << "{\"turns\":" << _turns << ",\"sections\":[";
+	bool first = true;
+	for (const auto& x : report()) {
+		if (!first) fout << ',';
+		first = false;
+		fout << "\n{\"name\":\"" << x.name << "\",\"calls\":" << x.calls << ",\"ms\":" << _ms(x.elapsed)
+			<< ",\"last_turn_ms\":" << _ms(x.last_turn) << ",\"worst_turn_ms\":" << _ms(x.worst_turn) << '}';
+	}
+	fout << "\n]}\n";
+	return bool(fout);
+}
+
+std::vector<turn_profile::section> turn_profile::report() const
+{
+	std::vector<section> ret;
+	for (auto x : _sections) {
+		x.calls += x.turn_calls;	// include the turn in progress
+		x.elapsed += x.turn_elapsed;
+		if (0 < x.calls) ret.push_back(x);
+	}
+	std::sort(ret.begin(), ret.end(), [](const section& lhs, const section& rhs) { return lhs.elapsed > rhs.elapsed; });
+	return ret;
+}
+
+#undef SUMMARY_FILE
+#undef TRACE_FILE
+#endif
@@ -0,0 +1,81 @@
+#ifndef PROFILE_HPP
+#define PROFILE_HPP 1
+
+// Wall-clock timers for the turn loop and its known hot spots.  Build with -DPROFILE_TURNS to enable; otherwise the
+// macros below compile to nothing.  Times are inclusive: a map::sees call made from monmove counts toward both.
+
+#if defined(PROFILE_TURNS) && !defined(SOCRATES_DAIMON)
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// singleton
+class turn_profile
+{
+public:
+	struct section {
+		const char* name;
+		unsigned long calls;
+		std::chrono::steady_clock::duration elapsed;
+		unsigned long turn_calls;	// since the last end_turn
+		std::chrono::steady_clock::duration turn_elapsed;
+		std::chrono::steady_clock::duration last_turn;	// as of the last end_turn
+		std::chrono::steady_clock::duration worst_turn;
+	};
+
+	class timer {
+		section& _dest;
+		const std::chrono::steady_clock::time_point _start;
+	public:
+		timer(section& dest) : _dest(dest), _start(std::chrono::steady_clock::now()) {}
+		timer(const timer& src) = delete;
+		timer(timer&& src) = delete;
+		~timer() {
+			const auto dt = std::chrono::steady_clock::now() - _start;
+			_dest.turn_calls++;
+			_dest.turn_elapsed += dt;
+		}
+		timer& operator=(const timer& src) = delete;
+		timer& operator=(timer&& src) = delete;
+	};
+
+private:
+	std::deque<section> _sections;	// references handed out by find must stay valid
+	unsigned long _turns;
+	std::ofstream _trace;
+
+	turn_profile() : _turns(0) {}
+	~turn_profile() = default;
+	turn_profile(const turn_profile& src) = delete;
+	turn_profile(turn_profile&& src) = delete;
+	turn_profile& operator=(const turn_profile& src) = delete;
+	turn_profile& operator=(turn_profile&& src) = delete;
+public:
+	static turn_profile& get();
+	section& find(const char* name);	// creates if needed
+
+	void end_turn(int turn);	// folds this turn into the session totals; writes a trace row if tracing
+	void reset();
+
+	bool tracing() const { return _trace.is_open(); }
+	bool trace(bool on);	// per-turn CSV to save/profile.csv; false if the file could not be opened
+	bool write_json() const;	// session totals to save/profile.json
+
+	std::vector<section> report() const;	// this session, most expensive first
+	unsigned long turns() const { return _turns; }
+};
+
+#define PROFILE_CAT2(A,B) A##B
+#define PROFILE_CAT(A,B) PROFILE_CAT2(A,B)
+#define PROFILE_SCOPE(NAME)	\
+	static turn_profile::section& PROFILE_CAT(_profile_section_,__LINE__) = turn_profile::get().find(NAME);	\
+	turn_profile::timer PROFILE_CAT(_profile_timer_,__LINE__)(PROFILE_CAT(_profile_section_,__LINE__))
+#define PROFILE_END_TURN(TURN) turn_profile::get().end_turn(TURN)
+#else
+#define PROFILE_SCOPE(NAME)
+#define PROFILE_END_TURN(TURN)
+#endif
+
+#endif
@@ -8,7 +8,7 @@
 #include "options.h"
 #include "mondeath.h"
 #include "gui.hpp"
-#include "posix_time.h"
+#include "animation.hpp"
 #include "recent_msg.h"
 
 #include <math.h>
@@ -301,8 +301,8 @@ void game::fire(player& p, std::vector<GPS_loc>& trajectory, bool burst)
 
     // Make a sound at our location - Zombies will chase it
     make_gun_sound_effect(this, p, burst);
-    // Set up a timespec for use in the nanosleep function below
-    timespec ts = { 0,  BULLET_SPEED };
+    const bool animate = animation::enabled();
+    std::vector<GPS_loc> restore;
 
     bool missed = false;
     for (int curshot = 0; curshot < num_shots; curshot++) {
@@ -391,17 +391,15 @@ retry_new_target:
 
         int dam = p.weapon.gun_damage();
         for (int i = 0; i < trajectory.size() && (dam > 0 || (flags & IF_AMMO_FLAME)); i++) {
-            if (i > 0)
-                map::drawsq(w_terrain, u, trajectory[i - 1], false, true);
-            // Drawing the bullet uses player u, and not player p, because it's drawn
-            // relative to YOUR position, which may not be the gunman's position.
-            if (u.see(trajectory[i])) {
-                if (const auto pos = toScreen(trajectory[i])) {
+            if (animate) {
+                if (i > 0) restore.push_back(trajectory[i - 1]);
+                // Drawing the bullet uses player u, and not player p, because it's drawn
+                // relative to YOUR position, which may not be the gunman's position.
+                if (u.see(trajectory[i])) {
                     char bullet = (flags & mfb(IF_AMMO_FLAME)) ? '#' : '*';
-                    const point pt(*pos + point(VIEW_CENTER) - u.pos);
-                    mvwputch(w_terrain, pt.y, pt.x, c_red, bullet);
-                    wrefresh(w_terrain);
-                    if (&p == &u) nanosleep(&ts, nullptr);
+                    std::vector<animation::glyph> frame(1, animation::glyph(trajectory[i], c_red, bullet));
+                    animation::get().add(std::move(frame), (&p == &u) ? BULLET_SPEED : 0, std::move(restore));
+                    restore.clear();
                 }
             }
 
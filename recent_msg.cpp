@@ -6,12 +6,37 @@
 #include "ui.h"
 #include "options.h"
 #include "zero.h"
+#include <fstream>
 #include <stdarg.h>
 #endif
 
 recent_msg messages;
 
 #ifndef SOCRATES_DAIMON
+#define LOG_FILE "save/messages.log"
+
+// Full history, for searching outside the game; the in-memory ring only keeps the last MAX_MSGS.
+// Append-only, and flushed on save rather than per message.
+static std::ofstream message_log;
+
+static std::ofstream* _message_log()
+{
+	if (!option_table::get()[OPT_MESSAGE_LOG]) {
+		if (message_log.is_open()) message_log.close();
+		return nullptr;
+	}
+	if (!message_log.is_open()) {
+		message_log.clear();
+		message_log.open(LOG_FILE, std::ios::app);
+	}
+	return message_log ? &message_log : nullptr;
+}
+
+void recent_msg::flush_log()
+{
+	if (message_log.is_open()) message_log.flush();
+}
+
 void recent_msg::_add(const char* msg, ...)
 {
     if (reject_not_whitelisted_printf(msg)) return;
@@ -32,8 +57,9 @@ void recent_msg::_record(const char* msg)
 {
 	std::string s(msg);
 	if (s.empty()) return;
-	if (!msgs.empty()) {
-		auto& msg = msgs.back();
+	if (auto log = _message_log()) *log << int(turn) << '\t' << s << '\n';
+	if (0 < msg_count) {
+		auto& msg = _msg(msg_count - 1);
 		if (int(msg.turn) + 3 >= int(turn) && s == msg.message) {
 			msg.count++;
 			msg.turn = turn;
@@ -41,8 +67,13 @@ void recent_msg::_record(const char* msg)
 		}
 	}
 
-	while (256 <= msgs.size()) msgs.erase(msgs.begin());
-	msgs.push_back(game_message(turn, std::move(s))); // UI; no measurable benefit from eliminating a move-assignment w/emplace_back
+	if (MAX_MSGS > msg_count) {
+		_msg(msg_count++) = game_message(turn, std::move(s));
+		return;
+	}
+	// full: overwrite the oldest message in place
+	msgs[msg_head] = game_message(turn, std::move(s));
+	msg_head = (msg_head + 1) % MAX_MSGS;
 }
 
 void recent_msg::buffer() const
@@ -60,8 +91,8 @@ void recent_msg::buffer() const
   int line = 1;
   int lasttime = -1;
   int i;
-  for (i = 1; i <= VIEW - 5 && line <= VIEW - 2 && offset + i <= msgs.size(); i++) {
-   const game_message& mtmp = msgs[msgs.size() - (offset + i)];
+  for (i = 1; i <= VIEW - 5 && line <= VIEW - 2 && offset + i <= msg_count; i++) {
+   const game_message& mtmp = _msg(msg_count - (offset + i));
    calendar timepassed = turn - mtmp.turn;
 
    int tp = int(timepassed);
@@ -92,10 +123,10 @@ void recent_msg::buffer() const
      line++;
     }
    } // if (line <= 23)
-  } //for (i = 1; i <= 10 && line <= 23 && offset + i <= msgs.size(); i++)
+  } //for (i = 1; i <= 10 && line <= 23 && offset + i <= msg_count; i++)
   // Arguable whether the arrows should "spread out" as the screen gets wider. 2020-10-10 zaimoni
   if (offset > 0) mvwaddstrz(w, VIEW - 1, SCREEN_WIDTH / 2 - 13, c_magenta, "^^^");
-  if (offset + i < msgs.size()) mvwaddstrz(w, VIEW - 1, SCREEN_WIDTH / 2 + 10, c_magenta, "vvv");
+  if (offset + i < msg_count) mvwaddstrz(w, VIEW - 1, SCREEN_WIDTH / 2 + 10, c_magenta, "vvv");
   wrefresh(w);
 
   ch = input();
@@ -104,7 +135,7 @@ void recent_msg::buffer() const
   if        (-1 == dir.y) {
       if (0 < offset) offset--;
   } else if (1 == dir.y) {
-      if (msgs.size() > offset) offset++;
+      if (msg_count > offset) offset++;
   }
  } while (ch != 'q' && ch != 'Q' && ch != ' ');
 
@@ -117,11 +148,12 @@ void recent_msg::write(WINDOW* w_messages)
  werase(w_messages);
  int maxlength = getmaxx(w_messages) - 2;
  int line = getmaxy(w_messages) - 1;
- for (int i = msgs.size() - 1; 0 <= i && 0 <= line; i--) {
-  std::string mes = msgs[i].message;
-  if (1 < msgs[i].count) {
+ for (int i = msg_count - 1; 0 <= i && 0 <= line; i--) {
+  const game_message& mtmp = _msg(i);
+  std::string mes = mtmp.message;
+  if (1 < mtmp.count) {
    mes += " x ";
-   mes += std::to_string(msgs[i].count);
+   mes += std::to_string(mtmp.count);
   }
 // Split the message into many if we must!
   size_t split;
@@ -130,9 +162,9 @@ void recent_msg::write(WINDOW* w_messages)
    if (split > maxlength)
     split = maxlength;
    nc_color col = c_dkgray;
-   if (int(msgs[i].turn) >= curmes)
+   if (int(mtmp.turn) >= curmes)
     col = c_ltred;
-   else if (int(msgs[i].turn) + 5 >= curmes)
+   else if (int(mtmp.turn) + 5 >= curmes)
     col = c_ltgray;
    mvwaddstrz(w_messages, line, 0, col, mes.substr(split + 1).c_str());
    mes = mes.substr(0, split);
@@ -141,9 +173,9 @@ void recent_msg::write(WINDOW* w_messages)
   }
   if (line >= 0) {
    nc_color col = c_dkgray;
-   if (int(msgs[i].turn) >= curmes)
+   if (int(mtmp.turn) >= curmes)
     col = c_ltred;
-   else if (int(msgs[i].turn) + 5 >= curmes)
+   else if (int(mtmp.turn) + 5 >= curmes)
     col = c_ltgray;
    mvwaddstrz(w_messages, line, 0, col, mes.c_str());
    line--;
@@ -152,4 +184,5 @@ void recent_msg::write(WINDOW* w_messages)
  curmes = int(turn);
  wrefresh(w_messages);
 }
+#undef LOG_FILE
 #endif
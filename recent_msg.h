@@ -5,7 +5,7 @@
 #ifndef SOCRATES_DAIMON
 #include "wrap_curses.h"
 #endif
-#include <vector>
+#include <array>
 
 class recent_msg
 {
@@ -25,13 +25,21 @@ private:
 		~game_message() = default;
 	};
 
-	std::vector<game_message> msgs;   // Messages to be printed
+	static constexpr const size_t MAX_MSGS = 256;
+
+	std::array<game_message, MAX_MSGS> msgs;   // Messages to be printed; ring buffer, oldest at msg_head
+	size_t msg_head;
+	size_t msg_count;
 	int curmes;	  // The last-seen message.
 
+	// 0 is the oldest retained message
+	game_message& _msg(size_t i) { return msgs[(msg_head + i) % MAX_MSGS]; }
+	const game_message& _msg(size_t i) const { return msgs[(msg_head + i) % MAX_MSGS]; }
+
 public:
 	calendar turn;	// this is not a reasonable location for global time, if indeed we should be using global time rather than per-overmap time
 
-	recent_msg() : curmes(0) {}
+	recent_msg() : msg_head(0), msg_count(0), curmes(0) {}
 	recent_msg(const recent_msg& src) = delete;
 	recent_msg(recent_msg&& src) = delete;
 	~recent_msg() = default;
@@ -39,7 +47,8 @@ public:
 	recent_msg& operator=(recent_msg&& src) = delete;
 
 	void clear() {
-		msgs.clear();
+		msg_head = 0;
+		msg_count = 0;
 		curmes = 0;
 	}
 
@@ -55,6 +64,7 @@ public:
 	void add(const std::string& src) { _record(src.c_str()); }
 	void buffer() const;
 	void write(WINDOW* w_messages);
+	static void flush_log();
 private:
 	void _add(const char* msg, ...);
 	void _record(const char* msg);
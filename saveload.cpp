@@ -967,8 +967,6 @@ submap::submap(std::istream& is, tripoint& gps) : submap(0)
 {
 	is >> turn_last_touched;
 	GPS = gps;
-	int turndif = int(messages.turn);
-	if (turndif < 0) turndif = 0;
 
 	if ('{' != (is >> std::ws).peek()) throw std::runtime_error("submap data lost: pre-V0.2.0 format?");
 	{
@@ -1000,23 +998,18 @@ submap::submap(std::istream& is, tripoint& gps) : submap(0)
 				auto& col = rad_map[j];
 				int i = -1;
 				while (++i < col.size() && i < SEEX) {
-					if (fromJSON(col[i], radtmp)) {
-						radtmp -= int(turndif / 100);	// Radiation slowly decays	\todo V 0.2.1+ handle this as a true game time effect; no saveload-purging of radiation
-						if (radtmp < 0) radtmp = 0;
-						rad[i][j] = radtmp;
-					}
+					if (fromJSON(col[i], radtmp)) rad[i][j] = radtmp;	// decay is submap::catch_up's job
 				}
 			}
 		}
 		else if (sm.has_key("const_radiation") && fromJSON(sm["const_radiation"], radtmp)) {
-			radtmp -= int(turndif / 100);	// Radiation slowly decays	\todo V 0.2.1+ handle this as a true game time effect; no saveload-purging of radiation
-			if (radtmp < 0) radtmp = 0;
 			for (int j = 0; j < SEEY; j++) {
 				for (int i = 0; i < SEEX; i++) {
 					rad[i][j] = radtmp;
 				}
 			}
 		} else throw std::runtime_error("radiation data missing");
+		if (sm.has_key("rad_pending")) fromJSON(sm["rad_pending"], rad_pending);
 
 		if (sm.has_key("spawns")) sm["spawns"].decode(spawns);
 		if (sm.has_key("vehicles")) {
@@ -1100,6 +1093,7 @@ std::ostream& operator<<(std::ostream& os, const submap& src)
 	}
 	if (need_full) sm.set("radiation", std::move(_tmp));
 	else sm.set("const_radiation", std::to_string(first_radiation));
+	if (0 < src.rad_pending) sm.set("rad_pending", std::to_string(src.rad_pending));
 
 	if (!src.spawns.empty()) sm.set("spawns", JSON::encode(src.spawns));
 	if (!src.vehicles.empty()) sm.set("vehicles", JSON::encode(src.vehicles));
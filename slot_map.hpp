@@ -0,0 +1,129 @@
+#ifndef SLOT_MAP_HPP
+#define SLOT_MAP_HPP 1
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <stddef.h>
+
+// Element storage whose elements never move: pointers and indexes stay valid until that element is erased, even across
+// insertions.  Erased slots are reused (most recently freed first); a handle (index, generation) detects such reuse.
+// Iteration visits live slots in index order.
+template<class T, size_t BLOCK = 64>
+class slot_map final
+{
+public:
+	struct handle {
+		size_t index;
+		unsigned int generation;
+	};
+
+private:
+	std::vector<std::unique_ptr<std::optional<T>[]> > _blocks;
+	std::vector<unsigned int> _generation;	// per slot; bumped on erase
+	std::vector<size_t> _free;
+	size_t _live;
+
+	std::optional<T>& _slot(size_t i) { return _blocks[i / BLOCK][i % BLOCK]; }
+	const std::optional<T>& _slot(size_t i) const { return _blocks[i / BLOCK][i % BLOCK]; }
+
+	size_t _claim() {
+		if (!_free.empty()) {
+			const size_t ret = _free.back();
+			_free.pop_back();
+			return ret;
+		}
+		const size_t ret = _generation.size();
+		if (ret >= _blocks.size() * BLOCK) _blocks.push_back(std::make_unique<std::optional<T>[]>(BLOCK));
+		_generation.push_back(0);
+		return ret;
+	}
+
+	template<class Map, class V>
+	class _iterator {
+		Map* _src;
+		size_t _i;
+
+		void _skip() { while (_i < _src->ub() && !_src->_slot(_i)) ++_i; }
+
+	public:
+		_iterator(Map* src, size_t i) : _src(src), _i(i) { _skip(); }
+
+		V& operator*() const { return *_src->_slot(_i); }
+		V* operator->() const { return &*_src->_slot(_i); }
+		_iterator& operator++() { ++_i; _skip(); return *this; }
+		bool operator==(const _iterator& rhs) const { return _i == rhs._i; }
+		bool operator!=(const _iterator& rhs) const { return _i != rhs._i; }
+		size_t index() const { return _i; }
+	};
+
+public:
+	using iterator = _iterator<slot_map, T>;
+	using const_iterator = _iterator<const slot_map, const T>;
+
+	slot_map() : _live(0) {}
+	slot_map(const slot_map& src) = delete;
+	slot_map(slot_map&& src) = default;
+	~slot_map() = default;
+	slot_map& operator=(const slot_map& src) = delete;
+	slot_map& operator=(slot_map&& src) = default;
+
+	size_t size() const { return _live; }
+	bool empty() const { return 0 >= _live; }
+	size_t ub() const { return _generation.size(); }	// strict upper bound on live indexes
+
+	T* at(size_t i) { return (i < ub() && _slot(i)) ? &*_slot(i) : nullptr; }
+	const T* at(size_t i) const { return (i < ub() && _slot(i)) ? &*_slot(i) : nullptr; }
+	// i must be live
+	T& operator[](size_t i) { return *_slot(i); }
+	const T& operator[](size_t i) const { return *_slot(i); }
+
+	handle handle_of(size_t i) const { return handle{ i, _generation[i] }; }
+	T* get(const handle& h) { return (h.index < ub() && _generation[h.index] == h.generation) ? at(h.index) : nullptr; }
+	const T* get(const handle& h) const { return (h.index < ub() && _generation[h.index] == h.generation) ? at(h.index) : nullptr; }
+
+	// returns index
+	template<class...Args>
+	size_t emplace(Args&&...params) {
+		const size_t ret = _claim();
+		_slot(ret).emplace(std::forward<Args>(params)...);
+		++_live;
+		return ret;
+	}
+	size_t insert(const T& src) { return emplace(src); }
+	size_t insert(T&& src) { return emplace(std::move(src)); }
+
+	void erase(size_t i) {
+		auto& dest = _slot(i);
+		if (!dest) return;
+		dest.reset();
+		++_generation[i];
+		_free.push_back(i);
+		--_live;
+	}
+
+	template<class F>
+	void erase_if(F&& reject) {
+		const size_t strict_ub = ub();
+		for (size_t i = 0; i < strict_ub; ++i) {
+			if (auto& x = _slot(i); x && reject(*x, i)) erase(i);
+		}
+	}
+
+	void reserve(size_t n) {	// bookkeeping only; elements are allocated a block at a time
+		_blocks.reserve((n + BLOCK - 1) / BLOCK);
+		_generation.reserve(n);
+	}
+
+	void clear() {	// generations are kept, so handles issued before now stay stale
+		for (size_t i = 0; i < ub(); ++i) erase(i);
+	}
+
+	iterator begin() { return iterator(this, 0); }
+	iterator end() { return iterator(this, ub()); }
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, ub()); }
+};
+
+#endif
@@ -14,11 +14,17 @@
 #include "mutation.h"
 #include <stdexcept>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #include <fstream>
 #include <filesystem>
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
 
 using namespace cataclysm;
 
@@ -36,6 +42,28 @@ static void check_roundtrip_JSON(const item& src)
 	if (src != staging) throw std::logic_error("round-trip was not invariant");
 }
 
+// the round-trip checks are independent of each other and of page generation; caller must keep src alive until the futures are retrieved
+static auto check_roundtrip_JSON(const std::vector<item>& src)
+{
+	std::vector<std::future<void> > ret;
+	if (src.empty()) return ret;
+	const size_t workers = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, src.size());
+	for (size_t w = 0; w < workers; w++) {
+		ret.push_back(std::async(std::launch::async, [&src, w, workers]() {
+			for (size_t i = w; i < src.size(); i += workers) check_roundtrip_JSON(src[i]);
+		}));
+	}
+	return ret;
+}
+
+// replace target with the just-written target.tmp
+static void publish(const char* const target)
+{
+	const std::string staged = std::string(target) + ".tmp";
+	unlink(target);
+	rename(staged.c_str(), target);
+}
+
 template<class T>
 static void to_desc(const std::vector<T*>& src, std::map<std::string, std::string>& dest, std::map<std::string, int>& ids)
 {
@@ -223,6 +251,7 @@ static void inline_script(html::to_text& page, const char* const src)
 		page.start_print(_script);
 		page.raw_copy(in);
 		page.end_print();
+		fclose(in);
 	}
 }
 
@@ -235,6 +264,174 @@ std::string skill_link(skill sk)
 	return link_to(sk_name, SKILLS_HTML, html::encode_id(sk_name).c_str()).to_s();
 }
 
+// FNV-1a digest of everything a page is built from.  Only ever compared to the manifest from an earlier run.
+class page_digest
+{
+	unsigned long long _x;
+
+	void _mix(const void* src, size_t len) {
+		auto bytes = reinterpret_cast<const unsigned char*>(src);
+		while (0 < len--) {
+			_x ^= *bytes++;
+			_x *= 1099511628211ULL;
+		}
+	}
+public:
+	page_digest() : _x(14695981039346656037ULL) {}
+	page_digest(const page_digest& src) = default;
+	page_digest(page_digest&& src) = default;
+	~page_digest() = default;
+	page_digest& operator=(const page_digest& src) = default;
+	page_digest& operator=(page_digest&& src) = default;
+
+	template<class T> requires(std::is_arithmetic_v<T> || std::is_enum_v<T>)
+	page_digest& operator<<(T src) {
+		_mix(&src, sizeof(src));
+		return *this;
+	}
+	page_digest& operator<<(const std::string& src) {
+		*this << src.size();
+		_mix(src.data(), src.size());
+		return *this;
+	}
+	page_digest& operator<<(const char* src) {
+		if (!src) return *this << (size_t)(-1);
+		return *this << std::string(src);
+	}
+	// pages print the JSON keys of these, not their values
+	page_digest& operator<<(itype_id src) { return *this << JSON_key(src); }
+	page_digest& operator<<(const component& src) { return *this << src.type << src.count; }
+	template<class T>
+	page_digest& operator<<(const std::vector<T>& src) {
+		*this << src.size();
+		for (decltype(auto) x : src) *this << x;
+		return *this;
+	}
+
+	page_digest& file(const char* src) {	// inlined scripts are read at build time
+		if (FILE* in = fopen(src, "rb")) {
+			unsigned char buf[4096];
+			size_t n;
+			while (0 < (n = fread(buf, 1, sizeof(buf), in))) _mix(buf, n);
+			fclose(in);
+		} else *this << (size_t)(-1);
+		return *this;
+	}
+
+	unsigned long long value() const { return _x; }
+};
+
+// The page layout and the renderers (html.cpp, color.cpp, ...) are compiled into this tool, so the executable itself is an
+// input of every page.  Set once in main, before any page is queued.
+static unsigned long long tool_digest = 0;
+
+// one published page.  A job owns its <head> and navigation fragments, so jobs share no mutable DOM and the site can
+// be built by a pool of workers.
+struct page_job
+{
+	const char* target;
+	html::tag head;
+	html::tag nav;
+	unsigned long long inputs;	// taken before building
+	std::function<void(html::to_text&, const html::tag&)> body;	// everything inside <body>, including the navigation
+
+	page_job(const char* dest, const char* title, const html::tag& _head, html::tag&& _nav, page_digest&& src,
+		std::function<void(html::to_text&, const html::tag&)>&& _body)
+		: target(dest), head(_head), nav(std::move(_nav)), body(std::move(_body)) {
+		auto _title = head.querySelector("title");
+#ifndef NDEBUG
+		if (!_title) throw std::logic_error("title tag AWOL");
+#endif
+		_title->append(html::tag::wrap(title));
+		src << tool_digest << head.to_s() << nav.to_s();
+		inputs = src.value();
+	}
+	page_job(const page_job& src) = delete;
+	page_job(page_job&& src) = default;
+	~page_job() = default;
+	page_job& operator=(const page_job& src) = delete;
+	page_job& operator=(page_job&& src) = default;
+
+	bool build() const {
+		static const html::tag _html("html");	// stage-printed
+		static const html::tag _body("body");	// stage-printed; this is where the JS for any dynamic HTML, etc. has to be inlined
+
+		const std::string staged = std::string(target) + ".tmp";
+		FILE* out = fopen(staged.c_str(), "w");
+		if (!out) return false;
+		{
+		html::to_text page(out);
+		page.start_print(_html);
+		page.print(head);
+		page.start_print(_body);
+		body(page, nav);
+		while (page.end_print());
+		}
+		publish(target);
+		return true;
+	}
+};
+
+// copy of the navigation menu for one page, with that page's own entry un-linked
+static html::tag nav_for(const html::tag& src, const std::string& selector, const char* link_name)
+{
+	html::tag ret(src);
+	swapDOM(selector, ret, html::tag("b", link_name));
+	return ret;
+}
+
+// input digests of the pages as last built; a page is rebuilt only when its digest changes
+#define PAGE_MANIFEST "html/.inputs"
+
+static std::map<std::string, unsigned long long> read_manifest()
+{
+	std::map<std::string, unsigned long long> ret;
+	std::ifstream in(PAGE_MANIFEST);
+	unsigned long long inputs;
+	std::string target;
+	while (in >> std::hex >> inputs >> target) ret[std::move(target)] = inputs;
+	return ret;
+}
+
+// pages that failed to open are left out, so they are retried next run
+static void write_manifest(const std::vector<page_job>& src, const std::vector<unsigned char>& current)
+{
+	{
+	std::ofstream out(PAGE_MANIFEST ".tmp");
+	for (size_t i = 0; i < src.size(); i++) {
+		if (current[i]) out << std::hex << src[i].inputs << ' ' << src[i].target << '\n';
+	}
+	}
+	unlink(PAGE_MANIFEST);
+	rename(PAGE_MANIFEST ".tmp", PAGE_MANIFEST);
+}
+
+// pages are independent of each other; caller must keep src, built, and current alive until the futures are retrieved
+static auto build_pages(const std::vector<page_job>& src, const std::map<std::string, unsigned long long>& built, std::vector<unsigned char>& current)
+{
+	std::vector<std::future<void> > ret;
+	current.assign(src.size(), 0);
+	if (src.empty()) return ret;
+	auto next = std::make_shared<std::atomic<size_t> >(0);
+	const size_t workers = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, src.size());
+	for (size_t w = 0; w < workers; w++) {
+		ret.push_back(std::async(std::launch::async, [&src, &built, &current, next]() {
+			size_t i;
+			while ((i = (*next)++) < src.size()) {
+				const auto& job = src[i];
+				const auto prior = built.find(job.target);
+				std::error_code ec;
+				if (built.end() != prior && prior->second == job.inputs && std::filesystem::exists(job.target, ec)) {
+					current[i] = 1;
+					continue;
+				}
+				current[i] = job.build();
+			}
+		}));
+	}
+	return ret;
+}
+
 int main(int argc, char *argv[])
 {
 	// these do not belong here
@@ -255,7 +452,20 @@ int main(int argc, char *argv[])
 	if (!std::filesystem::exists(target, ec) && !ec) create_directory(target, ec);	// do not want exception-throwing here
 	}
 
-	// \todo parse command line options
+	// command line options \todo more of them
+	bool rebuild = false;	// ignore the page manifest; build every page
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--rebuild")) rebuild = true;
+	}
+
+	{	// if we cannot read our own executable, nothing built by an earlier run can be trusted
+	std::error_code ec;
+	const char* const self = std::filesystem::exists("/proc/self/exe", ec) ? "/proc/self/exe" : argv[0];
+	if (FILE* in = fopen(self, "rb")) {
+		fclose(in);
+		tool_digest = page_digest().file(self).value();
+	} else rebuild = true;
+	}
 
 	srand(time(nullptr));
 
@@ -279,21 +489,16 @@ int main(int argc, char *argv[])
 	constructable::init();
 
 	// item HTML setup
-	const html::tag _html("html");	// stage-printed
-	// head tag will be mostly "common" between pages, but title will need adjusting
+	// head tag will be mostly "common" between pages; each page job gets its own copy with its title
 	html::tag _head("head");
 	_head.append(html::tag("title"));
 	// ....
-	html::tag* const _title = _head.querySelector("title");
-#ifndef NDEBUG
-	if (!_title) throw std::logic_error("title tag AWOL");
-#endif
-	// this is where the JS for any dynamic HTML, etc. has to be inlined
-	html::tag _body("body");	// stage-printed
-	// navigation sidebar will be "common", at least between page types
+	// navigation sidebar will be "common", at least between page types; each page job gets its own copy
 	html::tag global_nav("ul");
 	global_nav.set(attr_style, val_thin_border + CSS_sep + val_left_align + CSS_sep + val_list_none + CSS_sep + "margin:0px; padding:10px");
 
+	std::vector<page_job> site;	// built after all pages are queued
+
 #define HTML_DIR "html/"
 
 #define HOME_HTML "index.html"
@@ -320,29 +525,10 @@ int main(int argc, char *argv[])
 	global_nav.append(typicalMenuLink(NAVIGATION_ID, NAVIGATION_LINK_NAME, "./" NAVIGATION_HTML));
 	global_nav.append(typicalMenuLink(STATUS_ID, STATUS_LINK_NAME, "./" STATUS_HTML));
 
-	auto home_revert = swapDOM("#" HOME_ID, global_nav, html::tag("b", HOME_LINK_NAME));
-
-#define HTML_TARGET HTML_DIR HOME_HTML
-
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-		{
-		html::to_text page(out);
-		page.start_print(_html);
-		_title->append(html::tag::wrap("Cataclysm:Z " HOME_LINK_NAME));
-		page.print(_head);
-		_title->clear();
-		page.start_print(_body);
-		page.print(global_nav);
-		while (page.end_print());
-		}
-
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
-	}
-
-#undef HTML_TARGET
-
-	*home_revert.first = std::move(home_revert.second);
+	site.emplace_back(HTML_DIR HOME_HTML, "Cataclysm:Z " HOME_LINK_NAME, _head, nav_for(global_nav, "#" HOME_ID, HOME_LINK_NAME), page_digest(),
+		[](html::to_text& page, const html::tag& nav) {
+		page.print(nav);
+	});
 
 	// full item navigation menu
 	html::tag item_point("li");
@@ -428,31 +614,12 @@ int main(int argc, char *argv[])
 	item_point.append(item_nav);
 
 	// set up items submenu
-	home_revert = swapDOM("#" ITEMS_ID, global_nav, std::move(item_point));
-
-#define HTML_TARGET HTML_DIR ITEMS_HTML
-
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-		{
-			html::to_text page(out);
-			page.start_print(_html);
-			_title->append(html::tag::wrap("Cataclysm:Z " ITEMS_LINK_NAME));
-			page.print(_head);
-			_title->clear();
-			page.start_print(_body);
-			{
-			auto revert = swapDOM("#" ITEMS_ID "_link", global_nav, html::tag("b", ITEMS_LINK_NAME));
-			page.print(global_nav);
-			*revert.first = std::move(revert.second);
-			}
-			while (page.end_print());
-		}
-
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
-	}
+	auto home_revert = swapDOM("#" ITEMS_ID, global_nav, std::move(item_point));
 
-#undef HTML_TARGET
+	site.emplace_back(HTML_DIR ITEMS_HTML, "Cataclysm:Z " ITEMS_LINK_NAME, _head, nav_for(global_nav, "#" ITEMS_ID "_link", ITEMS_LINK_NAME), page_digest(),
+		[](html::to_text& page, const html::tag& nav) {
+		page.print(nav);
+	});
 
 	const html::tag _data_table("table");	// stage-printed
 
@@ -476,8 +643,8 @@ int main(int argc, char *argv[])
 
 	std::vector<std::pair<add_type, const it_comest*> > xref_addictions;
 
-	std::map<std::string, std::string> name_desc;
 	std::map<std::string, int> name_id;
+	std::vector<item> roundtrip_items;	// must outlive roundtrip_checks
 
 	// item type scan
 	auto ub = item::types.size();
@@ -619,1063 +786,238 @@ int main(int argc, char *argv[])
 			name_id[test.tname()] = it->id;
 			if (test.my_preferred_container()) {	// i.e., can create in own container
 				auto test2 = test.in_its_container();
-				if (test2.type != test.type) check_roundtrip_JSON(test2);
+				if (test2.type != test.type) roundtrip_items.push_back(std::move(test2));
 			}
-			if (num_items != it->id && itm_null != it->id) check_roundtrip_JSON(test);
+			if (num_items != it->id && itm_null != it->id) roundtrip_items.push_back(std::move(test));
 	}
+	auto roundtrip_checks = check_roundtrip_JSON(roundtrip_items);
+
+	// item pages: descriptions are rendered here, in the scan thread, and handed to the page jobs
+	const auto item_inputs = [&name_id](const std::map<std::string, std::string>& name_desc) {
+		page_digest ret;
+		for (const auto& x : name_desc) {
+			const auto it = item::types[name_id.at(x.first)];
+			ret << x.first << x.second << JSON_key((material)it->m1);
+			if (const auto food = it->is_food()) ret << JSON_key(food->add);
+		}
+		return ret;
+	};
+
+	const auto material_table = [&](html::to_text& page, const std::map<std::string, std::string>& name_desc) {
+		static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
+		page.start_print(_data_table);
+		// actual content
+		{
+			html::tag table_header("tr");
+			table_header.set(attr_align, val_center);
+			for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
+			page.print(table_header);
+		}
+		for (const auto& x : name_desc) {
+			page.open("tr").attr(attr_align, val_left);
+			page.open("td").attr(attr_valign, val_top).text(x.first).close();
+			page.open("td").attr(attr_valign, val_top).open("pre").raw(x.second).close().close();
+			page.open("td").attr(attr_valign, val_top);
+				if (auto mat = JSON_key((material)item::types[name_id.at(x.first)]->m1)) page.text(mat);
+			page.close().close();
+		}
+	};
+
+	const auto queue_item_page = [&](const char* target, const char* title, const char* selector, const char* link_name, const auto& src) {
+		if (src.empty()) return;
+		std::map<std::string, std::string> name_desc;
+		to_desc(src, name_desc, name_id);
+		auto inputs = item_inputs(name_desc);
+		site.emplace_back(target, title, _head, nav_for(global_nav, selector, link_name), std::move(inputs),
+			[&material_table, name_desc = std::move(name_desc)](html::to_text& page, const html::tag& nav) {
+			page.print(nav);
+			material_table(page, name_desc);
+		});
+	};
 
 	if (!ma_styles.empty()) {
+		std::map<std::string, std::string> name_desc;
 		to_desc(ma_styles, name_desc, name_id);
-#define HTML_TARGET HTML_DIR MARTIAL_ARTS_HTML
-
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
+		auto inputs = item_inputs(name_desc);
+		site.emplace_back(HTML_DIR MARTIAL_ARTS_HTML, "Cataclysm:Z " MARTIAL_ARTS_LINK_NAME, _head, nav_for(global_nav, "#" MARTIAL_ARTS_ID, MARTIAL_ARTS_LINK_NAME), std::move(inputs),
+			[&, name_desc = std::move(name_desc)](html::to_text& page, const html::tag& nav) {
+			page.print(nav);
 
+			static constexpr const char* table_headers[] = { "Name", "Description" };
+			page.start_print(_data_table);
+			// actual content
 			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " MARTIAL_ARTS_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" MARTIAL_ARTS_ID, global_nav, html::tag("b", MARTIAL_ARTS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
+				html::tag table_header("tr");
+				table_header.set(attr_align, val_center);
+				for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
+				page.print(table_header);
 			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
+			for (const auto& x : name_desc) {
+				page.open("tr").attr(attr_align, val_left);
+				page.open("td").attr(attr_valign, val_top).text(x.first).close();
+				page.open("td").attr(attr_valign, val_top).open("pre").raw(x.second).close().close();
+				page.close();
+			}
+		});
 	}
 
-	if (!armor.empty()) {
-		to_desc(armor, name_desc, name_id);
-#define HTML_TARGET HTML_DIR ARMOR_HTML
-
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
-
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " ARMOR_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" ARMOR_ID, global_nav, html::tag("b", ARMOR_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
+	queue_item_page(HTML_DIR ARMOR_HTML, "Cataclysm:Z " ARMOR_LINK_NAME, "#" ARMOR_ID, ARMOR_LINK_NAME, armor);
+	queue_item_page(HTML_DIR CONTAINERS_HTML, "Cataclysm:Z " CONTAINERS_LINK_NAME, "#" CONTAINERS_ID, CONTAINERS_LINK_NAME, containers);
+	queue_item_page(HTML_DIR BOOKS_HTML, "Cataclysm:Z " BOOKS_LINK_NAME, "#" BOOKS_ID, BOOKS_LINK_NAME, books);
+	queue_item_page(HTML_DIR DRINKS_HTML, "Cataclysm:Z " DRINKS_LINK_NAME, "#" DRINKS_ID, DRINKS_LINK_NAME, drinks);
 
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
+// duplicate definition, for hyperlinking
+#define ADDICTIONS_HTML "addictions.html"
 
-	if (!containers.empty()) {
-		to_desc(containers, name_desc, name_id);
-#define HTML_TARGET HTML_DIR CONTAINERS_HTML
+	// \todo need to document addictions related to these
+	if (!pharma.empty()) {
+		std::map<std::string, std::string> name_desc;
+		to_desc(pharma, name_desc, name_id);
+		auto inputs = item_inputs(name_desc);
+		site.emplace_back(HTML_DIR PHARMA_HTML, "Cataclysm:Z " PHARMA_LINK_NAME, _head, nav_for(global_nav, "#" PHARMA_ID, PHARMA_LINK_NAME), std::move(inputs),
+			[&, name_desc = std::move(name_desc)](html::to_text& page, const html::tag& nav) {
+			page.print(nav);
 
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
 			html::tag cell("td");
 			cell.set(attr_valign, val_top);
 
+			static constexpr const char* table_headers[] = { "Name", "Description", "Material", "Addiction" };
+			page.start_print(_data_table);
+			// actual content
 			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " CONTAINERS_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" CONTAINERS_ID, global_nav, html::tag("b", CONTAINERS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
+				html::tag table_header("tr");
+				table_header.set(attr_align, val_center);
+				for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
+				page.print(table_header);
+			}
+			{
+				html::tag table_row("tr");
+				table_row.set(attr_align, val_left);
+				for (decltype(auto) th : table_headers) table_row.append(cell);
+				decltype(auto) tr_alias = table_row.alias();
+				tr_alias[1]->append(html::tag("pre"));
+				tr_alias[1] = tr_alias[1]->querySelector("pre");
 
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
+				for (const auto& x : name_desc) {
+					auto med = dynamic_cast<it_comest*>(item::types.at(name_id.at(x.first)));
+					if (!med) continue;	// in container
+					tr_alias[0]->append(html::tag::wrap(x.first));
+					tr_alias[1]->append(html::tag::wrap(x.second));
+					if (auto mat = JSON_key((material)item::types[name_id.at(x.first)]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
+					if (auto med = dynamic_cast<it_comest*>(item::types.at(name_id.at(x.first)))) {
+						if (auto add = addiction_target(med->add)) tr_alias[3]->append(link_to(add, ADDICTIONS_HTML, JSON_key(med->add)));
+					} else throw std::logic_error(x.first+" not really consumable");
+					page.print(table_row);
+					for (decltype(auto) tr : tr_alias) tr->clear();
 				}
-
-				while (page.end_print());
 			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
+		});
 	}
 
-	if (!books.empty()) {
-		to_desc(books, name_desc, name_id);
-#define HTML_TARGET HTML_DIR BOOKS_HTML
+	queue_item_page(HTML_DIR EDIBLE_HTML, "Cataclysm:Z " EDIBLE_LINK_NAME, "#" EDIBLE_ID, EDIBLE_LINK_NAME, edible);
+	// \todo cross-link to what it reloads, etc.
+	queue_item_page(HTML_DIR GUNS_HTML, "Cataclysm:Z " GUNS_LINK_NAME, "#" GUNS_ID, GUNS_LINK_NAME, guns);
+	// \todo this may warrant a full planner, not just static cross-references
+	queue_item_page(HTML_DIR GUN_MODS_HTML, "Cataclysm:Z " GUN_MODS_LINK_NAME, "#" GUN_MODS_ID, GUN_MODS_LINK_NAME, gun_mods);
 
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
+	// XXX AT_ARROW must have range at least 10 to avoid breaking the longbow
+	// \todo make this fully computed
+	for (decltype(auto) x : ammunition) {
+		if (AT_ARROW == x->type && 10 > x->range) throw std::logic_error("longbow cannot handle weak arrows");
+	}
 
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " BOOKS_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" BOOKS_ID, global_nav, html::tag("b", BOOKS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
+	// \todo this should cross-link to the ranged weapons they fit
+	queue_item_page(HTML_DIR AMMO_HTML, "Cataclysm:Z " AMMO_LINK_NAME, "#" AMMO_ID, AMMO_LINK_NAME, ammunition);
+	queue_item_page(HTML_DIR FUEL_HTML, "Cataclysm:Z " FUEL_LINK_NAME, "#" FUEL_ID, FUEL_LINK_NAME, fuel);
+	queue_item_page(HTML_DIR TOOLS_HTML, "Cataclysm:Z " TOOLS_LINK_NAME, "#" TOOLS_ID, TOOLS_LINK_NAME, tools);
+	queue_item_page(HTML_DIR BIONICS_HTML, "Cataclysm:Z " BIONICS_LINK_NAME, "#" BIONICS_ID, BIONICS_LINK_NAME, bionics);
+	queue_item_page(HTML_DIR SOFTWARE_HTML, "Cataclysm:Z " SOFTWARE_LINK_NAME, "#" SOFTWARE_ID, SOFTWARE_LINK_NAME, software);
+	queue_item_page(HTML_DIR MACGUFFIN_HTML, "Cataclysm:Z " MACGUFFIN_LINK_NAME, "#" MACGUFFIN_ID, MACGUFFIN_LINK_NAME, macguffins);
+	queue_item_page(HTML_DIR UNCLASSIFIED_HTML, "Cataclysm:Z " UNCLASSIFIED_LINK_NAME, "#" UNCLASSIFIED_ID, UNCLASSIFIED_LINK_NAME, unclassified);
 
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
+	*home_revert.first = std::move(home_revert.second);	// items page family handled
 
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
+	// full terrain navigation menu
+	html::tag mapnav_point("li");
+	mapnav_point.set("id", NAVIGATION_ID);
+	{
+		html::tag a_tag("a", NAVIGATION_LINK_NAME);
+		a_tag.set("href", "./" NAVIGATION_HTML);
+		a_tag.set("id", NAVIGATION_ID "_link");
+		mapnav_point.append(std::move(a_tag));
 	}
 
-	if (!drinks.empty()) {
-		to_desc(drinks, name_desc, name_id);
-#define HTML_TARGET HTML_DIR DRINKS_HTML
+	html::tag mapnav_nav("ul");
+	mapnav_nav.set(attr_style, val_list_none);
 
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
+#define FIELDS_HTML "fields.html"
+#define FIELDS_ID "fields"
+#define FIELDS_LINK_NAME "Fields"
+#define TERRAIN_HTML "terrain.html"
+#define TERRAIN_ID "terrain"
+#define TERRAIN_LINK_NAME "Terrain"
+#define TRAPS_HTML "traps.html"
+#define TRAPS_ID "traps"
+#define TRAPS_LINK_NAME "Traps"
 
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " DRINKS_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" DRINKS_ID, global_nav, html::tag("b", DRINKS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
+	mapnav_nav.append(typicalMenuLink(FIELDS_ID, FIELDS_LINK_NAME, "./" FIELDS_HTML));
+	mapnav_nav.append(typicalMenuLink(TERRAIN_ID, TERRAIN_LINK_NAME, "./" TERRAIN_HTML));
+	mapnav_nav.append(typicalMenuLink(TRAPS_ID, TRAPS_LINK_NAME, "./" TRAPS_HTML));
 
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
+	mapnav_point.append(mapnav_nav);
 
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
+	// set up mapnav submenu
+	home_revert = swapDOM("#" NAVIGATION_ID, global_nav, std::move(mapnav_point));
+
+	site.emplace_back(HTML_DIR NAVIGATION_HTML, "Cataclysm:Z " NAVIGATION_LINK_NAME, _head, nav_for(global_nav, "#" NAVIGATION_ID "_link", NAVIGATION_LINK_NAME), page_digest(),
+		[](html::to_text& page, const html::tag& nav) {
+		page.print(nav);
+	});
 
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
+	{
+	page_digest inputs;
+	size_t ub = num_fields;
+	while (0 < --ub) {
+		const field_t& x = field::list[ub];
+		inputs << x.sym;
+		for (int i = 0; i < 3; i++) inputs << x.name[i] << x.color[i] << x.transparent[i] << x.dangerous[i];
 	}
 
-// duplicate definition, for hyperlinking
-#define ADDICTIONS_HTML "addictions.html"
+	site.emplace_back(HTML_DIR FIELDS_HTML, "Cataclysm:Z " FIELDS_LINK_NAME, _head, nav_for(global_nav, "#" FIELDS_ID "_link", FIELDS_LINK_NAME), std::move(inputs),
+		[&](html::to_text& page, const html::tag& nav) {
+		page.print(nav);
 
-	// \todo need to document addictions related to these
-	if (!pharma.empty()) {
-		to_desc(pharma, name_desc, name_id);
-#define HTML_TARGET HTML_DIR PHARMA_HTML
+		static constexpr const char* table_headers[] = { "Name", "ASCII", "Transparent?", "Dangerous?" };
+		page.start_print(_data_table);
+		// actual content
+		{
+			html::tag table_header("tr");
+			table_header.set(attr_align, val_center);
+			for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
+			page.print(table_header);
+		}
 
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
+		{
+			static const std::string yes("yes");
+			static const std::string color("color: ");
+			static const std::string background("; background-color:");
 			html::tag cell("td");
-			cell.set(attr_valign, val_top);
+			html::tag table_row("tr");
+			table_row.set(attr_align, val_left);
+			for (decltype(auto) th : table_headers) table_row.append(cell);
 
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " PHARMA_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" PHARMA_ID, global_nav, html::tag("b", PHARMA_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material", "Addiction" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						auto med = dynamic_cast<it_comest*>(item::types.at(name_id[x.first]));
-						if (!med) continue;	// in container
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						if (auto med = dynamic_cast<it_comest*>(item::types.at(name_id[x.first]))) {
-							if (auto add = addiction_target(med->add)) tr_alias[3]->append(link_to(add, ADDICTIONS_HTML, JSON_key(med->add)));
-						} else throw std::logic_error(x.first+" not really consumable");
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
-
-	if (!edible.empty()) {
-		to_desc(edible, name_desc, name_id);
-#define HTML_TARGET HTML_DIR EDIBLE_HTML
-
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
-
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " EDIBLE_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" EDIBLE_ID, global_nav, html::tag("b", EDIBLE_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
-
-	if (!guns.empty()) {
-		to_desc(guns, name_desc, name_id);
-#define HTML_TARGET HTML_DIR GUNS_HTML
-
-		// \todo cross-link to what it reloads, etc.
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
-
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " GUNS_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" GUNS_ID, global_nav, html::tag("b", GUNS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
-
-	// \todo this may warrant a full planner, not just static cross-references
-	if (!gun_mods.empty()) {
-		to_desc(gun_mods, name_desc, name_id);
-#define HTML_TARGET HTML_DIR GUN_MODS_HTML
-
-		// \todo cross-link to what it reloads, etc.
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
-
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " GUN_MODS_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" GUN_MODS_ID, global_nav, html::tag("b", GUN_MODS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
-
-	// \todo this should cross-link to the ranged weapons they fit
-	if (!ammunition.empty()) {
-		to_desc(ammunition, name_desc, name_id);
-#define HTML_TARGET HTML_DIR AMMO_HTML
-
-		// XXX AT_ARROW must have range at least 10 to avoid breaking the longbow
-		// \todo make this fully computed
-		for (decltype(auto) x : ammunition) {
-			if (AT_ARROW == x->type && 10 > x->range) throw std::logic_error("longbow cannot handle weak arrows");
-		}
-
-		// \todo cross-link to what it reloads, etc.
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
-
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " AMMO_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" AMMO_ID, global_nav, html::tag("b", AMMO_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
-
-	if (!fuel.empty()) {
-		to_desc(fuel, name_desc, name_id);
-#define HTML_TARGET HTML_DIR FUEL_HTML
-
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
-
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " FUEL_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" FUEL_ID, global_nav, html::tag("b", FUEL_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
-
-	if (!tools.empty()) {
-		to_desc(tools, name_desc, name_id);
-#define HTML_TARGET HTML_DIR TOOLS_HTML
-
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
-
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " TOOLS_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" TOOLS_ID, global_nav, html::tag("b", TOOLS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
-
-	if (!bionics.empty()) {
-		to_desc(bionics, name_desc, name_id);
-#define HTML_TARGET HTML_DIR BIONICS_HTML
-
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
-
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " BIONICS_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" BIONICS_ID, global_nav, html::tag("b", BIONICS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
-
-	if (!software.empty()) {
-		to_desc(software, name_desc, name_id);
-#define HTML_TARGET HTML_DIR SOFTWARE_HTML
-
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
-
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " SOFTWARE_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" SOFTWARE_ID, global_nav, html::tag("b", SOFTWARE_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
-
-	if (!macguffins.empty()) {
-		to_desc(macguffins, name_desc, name_id);
-#define HTML_TARGET HTML_DIR MACGUFFIN_HTML
-
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
-
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " MACGUFFIN_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" MACGUFFIN_ID, global_nav, html::tag("b", MACGUFFIN_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-
-				static constexpr const char* table_headers[] = { "Name", "Description", "Material" };
-				page.start_print(_data_table);
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
-
-	if (!unclassified.empty()) {
-		to_desc(unclassified, name_desc, name_id);
-#define HTML_TARGET HTML_DIR UNCLASSIFIED_HTML
-
-		if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-			html::tag cell("td");
-			cell.set(attr_valign, val_top);
-
-			{
-				html::to_text page(out);
-				page.start_print(_html);
-				_title->append(html::tag::wrap("Cataclysm:Z " UNCLASSIFIED_LINK_NAME));
-				page.print(_head);
-				_title->clear();
-				page.start_print(_body);
-				{
-				auto revert = swapDOM("#" UNCLASSIFIED_ID, global_nav, html::tag("b", UNCLASSIFIED_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-				}
-				page.start_print(_data_table);
-
-				static constexpr const char* table_headers[] = { "Name" , "Description" , "Material" };
-				// actual content
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-					decltype(auto) tr_alias = table_row.alias();
-					tr_alias[1]->append(html::tag("pre"));
-					tr_alias[1] = tr_alias[1]->querySelector("pre");
-
-					for (const auto& x : name_desc) {
-						tr_alias[0]->append(html::tag::wrap(x.first));
-						tr_alias[1]->append(html::tag::wrap(x.second));
-						if (auto mat = JSON_key((material)item::types[name_id[x.first]]->m1)) tr_alias[2]->append(html::tag::wrap(mat));
-						page.print(table_row);
-						for (decltype(auto) tr : tr_alias) tr->clear();
-					}
-				}
-
-				while (page.end_print());
-			}
-			unlink(HTML_TARGET);
-			rename(HTML_TARGET ".tmp", HTML_TARGET);
-		}
-
-#undef HTML_TARGET
-		decltype(name_desc) discard;
-		name_desc.swap(discard);
-	}
-
-	*home_revert.first = std::move(home_revert.second);	// items page family handled
-
-	// full terrain navigation menu
-	html::tag mapnav_point("li");
-	mapnav_point.set("id", NAVIGATION_ID);
-	{
-		html::tag a_tag("a", NAVIGATION_LINK_NAME);
-		a_tag.set("href", "./" NAVIGATION_HTML);
-		a_tag.set("id", NAVIGATION_ID "_link");
-		mapnav_point.append(std::move(a_tag));
-	}
-
-	html::tag mapnav_nav("ul");
-	mapnav_nav.set(attr_style, val_list_none);
-
-#define FIELDS_HTML "fields.html"
-#define FIELDS_ID "fields"
-#define FIELDS_LINK_NAME "Fields"
-#define TERRAIN_HTML "terrain.html"
-#define TERRAIN_ID "terrain"
-#define TERRAIN_LINK_NAME "Terrain"
-#define TRAPS_HTML "traps.html"
-#define TRAPS_ID "traps"
-#define TRAPS_LINK_NAME "Traps"
-
-	mapnav_nav.append(typicalMenuLink(FIELDS_ID, FIELDS_LINK_NAME, "./" FIELDS_HTML));
-	mapnav_nav.append(typicalMenuLink(TERRAIN_ID, TERRAIN_LINK_NAME, "./" TERRAIN_HTML));
-	mapnav_nav.append(typicalMenuLink(TRAPS_ID, TRAPS_LINK_NAME, "./" TRAPS_HTML));
-
-	mapnav_point.append(mapnav_nav);
-
-	// set up mapnav submenu
-	home_revert = swapDOM("#" NAVIGATION_ID, global_nav, std::move(mapnav_point));
-
-#define HTML_TARGET HTML_DIR NAVIGATION_HTML
-
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-		{
-		html::to_text page(out);
-		page.start_print(_html);
-		_title->append(html::tag::wrap("Cataclysm:Z " NAVIGATION_LINK_NAME));
-		page.print(_head);
-		_title->clear();
-		page.start_print(_body);
-		{
-		auto revert = swapDOM("#" NAVIGATION_ID "_link", global_nav, html::tag("b", NAVIGATION_LINK_NAME));
-		page.print(global_nav);
-		*revert.first = std::move(revert.second);
-		}
-		while (page.end_print());
-		}
-
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
-	}
-
-#undef HTML_TARGET
-
-#define HTML_TARGET HTML_DIR FIELDS_HTML
-
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-		{
-		html::to_text page(out);
-		page.start_print(_html);
-		_title->append(html::tag::wrap("Cataclysm:Z " FIELDS_LINK_NAME));
-		page.print(_head);
-		_title->clear();
-		page.start_print(_body);
-		{
-		auto revert = swapDOM("#" FIELDS_ID "_link", global_nav, html::tag("b", FIELDS_LINK_NAME));
-		page.print(global_nav);
-		*revert.first = std::move(revert.second);
-		}
-
-		static constexpr const char* table_headers[] = { "Name", "ASCII", "Transparent?", "Dangerous?" };
-		page.start_print(_data_table);
-		// actual content
-		{
-			html::tag table_header("tr");
-			table_header.set(attr_align, val_center);
-			for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-			page.print(table_header);
-		}
-
-		{
-			static const std::string yes("yes");
-			static const std::string color("color: ");
-			static const std::string background("; background-color:");
-			html::tag cell("td");
-			html::tag table_row("tr");
-			table_row.set(attr_align, val_left);
-			for (decltype(auto) th : table_headers) table_row.append(cell);
-
-			size_t ub = num_fields;
-			const char* css_fg = nullptr;
-			const char* css_bg = nullptr;
-			while (0 < --ub) {
-				const field_t& x = field::list[ub];
-				table_row[0].append(html::tag::wrap(x.name[0]));
-				if (to_css_colors(x.color[0], css_fg, css_bg)) {
-					html::tag colorize("span", std::string(1, x.sym));
-					colorize.set("style", color+ css_fg + background + css_bg);
-					table_row[1].append(std::move(colorize));
-				} else {
-					table_row[1].append(html::tag::wrap(std::string(1, x.sym)));
+			size_t ub = num_fields;
+			const char* css_fg = nullptr;
+			const char* css_bg = nullptr;
+			while (0 < --ub) {
+				const field_t& x = field::list[ub];
+				table_row[0].append(html::tag::wrap(x.name[0]));
+				if (to_css_colors(x.color[0], css_fg, css_bg)) {
+					html::tag colorize("span", std::string(1, x.sym));
+					colorize.set("style", color+ css_fg + background + css_bg);
+					table_row[1].append(std::move(colorize));
+				} else {
+					table_row[1].append(html::tag::wrap(std::string(1, x.sym)));
 				}
 				table_row[2].append(html::tag::wrap(x.transparent[0] ? "yes" : ""));
 				table_row[3].append(html::tag::wrap(x.dangerous[0] ? "yes" : ""));
@@ -1707,31 +1049,21 @@ int main(int argc, char *argv[])
 				for (decltype(auto) tr : table_row) tr.clear();
 			}
 		}
-
-		while (page.end_print());
-		}
-
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
+	});
 	}
 
-#undef HTML_TARGET
-
-#define HTML_TARGET HTML_DIR TERRAIN_HTML
+	{
+	page_digest inputs;
+	size_t ub = num_terrain_types;
+	while (0 < --ub) {
+		const ter_t& x = ter_t::list[ub];
+		inputs << x.name << x.sym << x.color << x.movecost << JSON_key(x.trap) << x.flags;
+	}
+	for (decltype(auto) x : ter_t::water_from_terrain) inputs << x.first;
 
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-		{
-		html::to_text page(out);
-		page.start_print(_html);
-		_title->append(html::tag::wrap("Cataclysm:Z " TERRAIN_LINK_NAME));
-		page.print(_head);
-		_title->clear();
-		page.start_print(_body);
-		{
-		auto revert = swapDOM("#" TERRAIN_ID "_link", global_nav, html::tag("b", TERRAIN_LINK_NAME));
-		page.print(global_nav);
-		*revert.first = std::move(revert.second);
-		}
+	site.emplace_back(HTML_DIR TERRAIN_HTML, "Cataclysm:Z " TERRAIN_LINK_NAME, _head, nav_for(global_nav, "#" TERRAIN_ID "_link", TERRAIN_LINK_NAME), std::move(inputs),
+		[&](html::to_text& page, const html::tag& nav) {
+		page.print(nav);
 
 		static constexpr const char* table_headers[] = { "Name", "ASCII", "time cost", "Trap?" };
 		page.start_print(_data_table);
@@ -1785,31 +1117,26 @@ int main(int argc, char *argv[])
 				}
 			}
 		}
-		while (page.end_print());
-		}
-
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
+	});
 	}
 
-#undef HTML_TARGET
-
-#define HTML_TARGET HTML_DIR TRAPS_HTML
+	{
+	page_digest inputs;
+	inputs.file("data/js/ZQuery.js").file("data/js/colorize_landing.js");
+	size_t ub = num_trap_types;
+	while (0 < --ub) {
+		const trap& x = *trap::traps[ub];
+		inputs << x.name << JSON_key((trap_id)ub) << x.sym << x.color << x.visibility << x.avoidance << x.difficulty << x.disarm_legal();
+		inputs << x.disarm_components.size();
+		for (const itype_id it : x.disarm_components) inputs << item::types[it]->name;
+		inputs << x.trigger_components.size();
+		for (decltype(auto) it : x.trigger_components) inputs << it.to_s();
+	}
 
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-		{
-		html::to_text page(out);
-		page.start_print(_html);
-		_title->append(html::tag::wrap("Cataclysm:Z " TRAPS_LINK_NAME));
-		page.print(_head);
-		_title->clear();
-		page.start_print(_body);
+	site.emplace_back(HTML_DIR TRAPS_HTML, "Cataclysm:Z " TRAPS_LINK_NAME, _head, nav_for(global_nav, "#" TRAPS_ID "_link", TRAPS_LINK_NAME), std::move(inputs),
+		[&](html::to_text& page, const html::tag& nav) {
 		inline_script(page, "data/js/ZQuery.js");
-		{
-		auto revert = swapDOM("#" TRAPS_ID "_link", global_nav, html::tag("b", TRAPS_LINK_NAME));
-		page.print(global_nav);
-		*revert.first = std::move(revert.second);
-		}
+		page.print(nav);
 
 		static constexpr const char* table_headers[] = { "Name", "ASCII", "visibility", "avoidance", "difficulty", "disarmed parts", "triggered parts" };
 		page.start_print(_data_table);
@@ -1876,15 +1203,9 @@ int main(int argc, char *argv[])
 			}
 			}
 		inline_script(page, "data/js/colorize_landing.js");
-		while (page.end_print());
-		}
-
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
+	});
 	}
 
-#undef HTML_TARGET
-
 	*home_revert.first = std::move(home_revert.second);	// mapnav page family handled
 
 	// player status pages
@@ -1933,280 +1254,334 @@ int main(int argc, char *argv[])
 	// set up statusnav submenu
 	home_revert = swapDOM("#" STATUS_ID, global_nav, std::move(statusnav_point));
 
-#define HTML_TARGET HTML_DIR STATUS_HTML
+	site.emplace_back(HTML_DIR STATUS_HTML, "Cataclysm:Z " STATUS_LINK_NAME, _head, nav_for(global_nav, "#" STATUS_ID "_link", STATUS_LINK_NAME), page_digest(),
+		[](html::to_text& page, const html::tag& nav) {
+		page.print(nav);
+	});
+
+	{
+	page_digest inputs;
+	inputs.file("data/js/ZQuery.js").file("data/js/colorize_landing.js");
+	size_t ub = NUM_ADDICTIONS;
+	while (0 < --ub) {
+		addiction test((add_type)ub);
+		inputs << addiction_name(test) << addiction_text(test) << JSON_key((add_type)ub);
+	}
+	inputs << xref_addictions.size();
+	for (decltype(auto) entry : xref_addictions) inputs << entry.first << entry.second->name;
+
+	site.emplace_back(HTML_DIR ADDICTIONS_HTML, "Cataclysm:Z " ADDICTIONS_LINK_NAME, _head, nav_for(global_nav, "#" ADDICTIONS_ID "_link", ADDICTIONS_LINK_NAME), std::move(inputs),
+		[&](html::to_text& page, const html::tag& nav) {
+		inline_script(page, "data/js/ZQuery.js");
+		page.print(nav);
 
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
+		static constexpr const char* table_headers[] = { "Name" , "Description", "Items" };
+		page.start_print(_data_table);
+		// actual content
 		{
-			html::to_text page(out);
-			page.start_print(_html);
-			_title->append(html::tag::wrap("Cataclysm:Z " STATUS_LINK_NAME));
-			page.print(_head);
-			_title->clear();
-			page.start_print(_body);
-			{
-				auto revert = swapDOM("#" STATUS_ID "_link", global_nav, html::tag("b", STATUS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-			}
-			while (page.end_print());
+			html::tag table_header("tr");
+			table_header.set(attr_align, val_center);
+			for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
+			page.print(table_header);
 		}
 
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
-	}
+		{
+			static const std::string color("color: ");
+			static const std::string background("; background-color:");
+			html::tag cell("td");
+			html::tag table_row("tr");
+			table_row.set(attr_align, val_left);
+			for (decltype(auto) th : table_headers) table_row.append(cell);
+			decltype(auto) tr_alias = table_row.alias();
+			tr_alias[1]->append(html::tag("pre"));
+			tr_alias[1] = tr_alias[1]->querySelector("pre");
 
-#undef HTML_TARGET
+			auto xref(xref_addictions);
+			size_t ub = NUM_ADDICTIONS;
+			const char* css_fg = nullptr;
+			const char* css_bg = nullptr;
+			while (0 < --ub) {
+				std::string what;
+				addiction test((add_type)ub);
+				tr_alias[0]->append(wrap_in_anchor(addiction_name(test), JSON_key((add_type)ub)));
+				tr_alias[1]->append(html::tag::wrap(addiction_text(test)));
 
-#define HTML_TARGET HTML_DIR ADDICTIONS_HTML
+				size_t xref_ub = xref.size();
+				while (0 < xref_ub) {
+					decltype(auto) entry = xref[--xref_ub];
+					if (entry.first != ub) continue;
+					if (what.empty()) what = entry.second->name;
+					else what += ", " + entry.second->name;
+					xref.erase(xref.begin() + xref_ub);
+				}
+				if (!what.empty()) tr_alias[2]->append(html::tag::wrap(std::move(what)));
 
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-		{
-			html::to_text page(out);
-			page.start_print(_html);
-			_title->append(html::tag::wrap("Cataclysm:Z " ADDICTIONS_LINK_NAME));
-			page.print(_head);
-			_title->clear();
-			page.start_print(_body);
-			inline_script(page, "data/js/ZQuery.js");
-			{
-				auto revert = swapDOM("#" ADDICTIONS_ID "_link", global_nav, html::tag("b", ADDICTIONS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
+				page.print(table_row);
+				for (decltype(auto) tr : tr_alias) tr->clear();
 			}
+		}
+		inline_script(page, "data/js/colorize_landing.js");
+	});
+	}
 
-			static constexpr const char* table_headers[] = { "Name" , "Description", "Items" };
-			page.start_print(_data_table);
-			// actual content
-			{
-				html::tag table_header("tr");
-				table_header.set(attr_align, val_center);
-				for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-				page.print(table_header);
-			}
+	{
+	page_digest inputs;
+	inputs.file("data/js/ZQuery.js").file("data/js/colorize_landing.js");
+	size_t ub = num_skill_types;
+	while (0 < --ub) {
+		skill test((skill)ub);
+		inputs << skill_name(test) << skill_description(test);
+	}
 
-			{
-				static const std::string color("color: ");
-				static const std::string background("; background-color:");
-				html::tag cell("td");
-				html::tag table_row("tr");
-				table_row.set(attr_align, val_left);
-				for (decltype(auto) th : table_headers) table_row.append(cell);
-				decltype(auto) tr_alias = table_row.alias();
-				tr_alias[1]->append(html::tag("pre"));
-				tr_alias[1] = tr_alias[1]->querySelector("pre");
+	site.emplace_back(HTML_DIR SKILLS_HTML, "Cataclysm:Z " SKILLS_LINK_NAME, _head, nav_for(global_nav, "#" SKILLS_ID "_link", SKILLS_LINK_NAME), std::move(inputs),
+		[&](html::to_text& page, const html::tag& nav) {
+		inline_script(page, "data/js/ZQuery.js");
+		page.print(nav);
 
-				size_t ub = NUM_ADDICTIONS;
-				const char* css_fg = nullptr;
-				const char* css_bg = nullptr;
-				while (0 < --ub) {
-					std::string what;
-					addiction test((add_type)ub);
-					tr_alias[0]->append(wrap_in_anchor(addiction_name(test), JSON_key((add_type)ub)));
-					tr_alias[1]->append(html::tag::wrap(addiction_text(test)));
-
-					size_t xref_ub = xref_addictions.size();
-					while (0 < xref_ub) {
-						decltype(auto) entry = xref_addictions[--xref_ub];
-						if (entry.first != ub) continue;
-						if (what.empty()) what = entry.second->name;
-						else what += ", " + entry.second->name;
-						xref_addictions.erase(xref_addictions.begin() + xref_ub);
-					}
-					if (!what.empty()) tr_alias[2]->append(html::tag::wrap(std::move(what)));
+		static constexpr const char* table_headers[] = { "Name" , "Description" };
+		page.start_print(_data_table);
+		// actual content
+		{
+			html::tag table_header("tr");
+			table_header.set(attr_align, val_center);
+			for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
+			page.print(table_header);
+		}
 
-					page.print(table_row);
-					for (decltype(auto) tr : tr_alias) tr->clear();
-				}
+		{
+			html::tag cell("td");
+			html::tag table_row("tr");
+			table_row.set(attr_align, val_left);
+			for (decltype(auto) th : table_headers) table_row.append(cell);
+			decltype(auto) tr_alias = table_row.alias();
+			tr_alias[1]->append(html::tag("pre"));
+			tr_alias[1] = tr_alias[1]->querySelector("pre");
+
+			size_t ub = num_skill_types;
+			while (0 < --ub) {
+				skill test((skill)ub);
+				const auto sk_name = skill_name(test);
+				tr_alias[0]->append(wrap_in_anchor(sk_name, html::encode_id(sk_name).c_str()));
+				tr_alias[1]->append(html::tag::wrap(skill_description(test)));
+
+				page.print(table_row);
+				for (decltype(auto) tr : tr_alias) tr->clear();
 			}
-			inline_script(page, "data/js/colorize_landing.js");
-			while (page.end_print());
 		}
+		inline_script(page, "data/js/colorize_landing.js");
+	});
+	}
 
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
+	{
+	page_digest inputs;
+	for (const recipe* const test : recipe::recipes) {
+		inputs << JSON_key(test->result) << test->category << JSON_key(test->sk_primary) << JSON_key(test->sk_secondary);
+		inputs << test->difficulty << test->time_desc() << test->tools << test->components;
+	}
+	for (decltype(auto) x : ter_t::water_from_terrain) {
+		inputs << JSON_key(x.first) << x.second.first.numerator() << x.second.first.denominator() << x.second.second.first << x.second.second.second;
 	}
 
-#undef HTML_TARGET
+	site.emplace_back(HTML_DIR CRAFTING_HTML, "Cataclysm:Z " CRAFTING_LINK_NAME, _head, nav_for(global_nav, "#" CRAFTING_ID "_link", CRAFTING_LINK_NAME), std::move(inputs),
+		[&](html::to_text& page, const html::tag& nav) {
+		page.print(nav);
 
-#define HTML_TARGET HTML_DIR SKILLS_HTML
+		static constexpr const char* table_headers[] = { "Result" , "Category", "Primary Skill", "Secondary Skill", "Difficulty", "Time", "Tools", "Components" };
+		page.start_print(_data_table);
+		// actual content
+		{
+			html::tag table_header("tr");
+			table_header.set(attr_align, val_center);
+			for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
+			page.print(table_header);
+		}
 
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
 		{
-			html::to_text page(out);
-			page.start_print(_html);
-			_title->append(html::tag::wrap("Cataclysm:Z " SKILLS_LINK_NAME));
-			page.print(_head);
-			_title->clear();
-			page.start_print(_body);
-			inline_script(page, "data/js/ZQuery.js");
-			{
-				auto revert = swapDOM("#" SKILLS_ID "_link", global_nav, html::tag("b", SKILLS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-			}
+			html::tag cell("td");
+			html::tag table_row("tr");
+			table_row.set(attr_align, val_left);
+			table_row.set(attr_valign, val_top);
+			for (decltype(auto) th : table_headers) table_row.append(cell);
 
-			static constexpr const char* table_headers[] = { "Name" , "Description" };
-			page.start_print(_data_table);
-			// actual content
-			{
-				html::tag table_header("tr");
-				table_header.set(attr_align, val_center);
-				for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-				page.print(table_header);
+			int ub = recipe::recipes.size();
+			while (0 <= --ub) {
+				const recipe* const test = recipe::recipes[ub];
+				if (auto json = JSON_key(test->result)) {
+					table_row[0].append(html::tag::wrap(json));
+					table_row[1].append(html::tag::wrap(crafting_category(test->category)));
+					if (auto primary = JSON_key((test->sk_primary))) table_row[2].append(html::tag::wrap(primary));
+					if (auto secondary = JSON_key((test->sk_secondary))) table_row[3].append(html::tag::wrap(secondary));
+					table_row[4].append(html::tag::wrap(std::to_string(test->difficulty)));
+					table_row[5].append(html::tag::wrap("<nobr>" + test->time_desc() + "</nobr>"));
+					if (!test->tools.empty()) table_row[6].append(html::tag::wrap(to_s(test->tools)));
+					if (!test->components.empty()) table_row[7].append(html::tag::wrap(to_s(test->components)));
+				} else throw std::logic_error("unidentified crafting result");
+
+				page.print(table_row);
+				for (decltype(auto) tr : table_row) tr.clear();
 			}
+		}
+		page.end_print();
 
-			{
-				html::tag cell("td");
-				html::tag table_row("tr");
-				table_row.set(attr_align, val_left);
-				for (decltype(auto) th : table_headers) table_row.append(cell);
-				decltype(auto) tr_alias = table_row.alias();
-				tr_alias[1]->append(html::tag("pre"));
-				tr_alias[1] = tr_alias[1]->querySelector("pre");
+		page.print(html::tag::wrap("Water may be taken from some terrain types.  Purifying before drinking recommended."));
 
-				size_t ub = num_skill_types;
-				while (0 < --ub) {
-					skill test((skill)ub);
-					const auto sk_name = skill_name(test);
-					tr_alias[0]->append(wrap_in_anchor(sk_name, html::encode_id(sk_name).c_str()));
-					tr_alias[1]->append(html::tag::wrap(skill_description(test)));
+		static constexpr const char* water_table_headers[] = { "Terrain", "Chance of food poisoning when drunk", "Severity" };
+		page.start_print(_data_table);
+		// actual content
+		{
+			html::tag table_header("tr");
+			table_header.set(attr_align, val_center);
+			for (decltype(auto) th : water_table_headers) table_header.append(html::tag("th", th));
+			page.print(table_header);
+		}
 
-					page.print(table_row);
-					for (decltype(auto) tr : tr_alias) tr->clear();
+		{
+			html::tag cell("td");
+			html::tag table_row("tr");
+			table_row.set(attr_align, val_left);
+			table_row.set(attr_valign, val_top);
+			for (decltype(auto) th : water_table_headers) table_row.append(cell);
+
+			for (decltype(auto) x : ter_t::water_from_terrain) {
+				if (auto json = JSON_key(x.first)) {
+					table_row[0].append(html::tag::wrap(json));
+					table_row[1].append(html::tag::wrap(std::to_string(x.second.first.numerator()) + " in " + std::to_string(x.second.first.denominator())));
+					table_row[2].append(html::tag::wrap(std::to_string(x.second.second.first) + " ... " + std::to_string(x.second.second.second)));
 				}
+				else throw std::logic_error("unhandled terrain as water source");
+
+				page.print(table_row);
+				for (decltype(auto) tr : table_row) tr.clear();
 			}
-			inline_script(page, "data/js/colorize_landing.js");
-			while (page.end_print());
 		}
+	});
+	}
 
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
+	{
+	page_digest inputs;
+	for (const constructable* const test : constructable::constructions) {
+		inputs << test->name << test->difficulty << test->stages.size();
+		for (decltype(auto) c_stage : test->stages) inputs << JSON_key(c_stage.terrain) << c_stage.time << c_stage.tools << c_stage.components;
 	}
 
-#undef HTML_TARGET
+	site.emplace_back(HTML_DIR CONSTRUCTION_HTML, "Cataclysm:Z " CONSTRUCTION_LINK_NAME, _head, nav_for(global_nav, "#" CONSTRUCTION_ID "_link", CONSTRUCTION_LINK_NAME), std::move(inputs),
+		[&](html::to_text& page, const html::tag& nav) {
+		page.print(nav);
 
-#define HTML_TARGET HTML_DIR CRAFTING_HTML
+		page.print(html::tag::wrap("The (primary) skill for all constructions, is carpentry.")); // \todo hyperlink to carpentry skill
 
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
+		static constexpr const char* table_headers[] = { "Result" , "Difficulty", "Stages" };
+		page.start_print(_data_table);
+		// actual content
 		{
-			html::to_text page(out);
-			page.start_print(_html);
-			_title->append(html::tag::wrap("Cataclysm:Z " CRAFTING_LINK_NAME));
-			page.print(_head);
-			_title->clear();
-			page.start_print(_body);
-			{
-				auto revert = swapDOM("#" CRAFTING_ID "_link", global_nav, html::tag("b", CRAFTING_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-			}
+			html::tag table_header("tr");
+			table_header.set(attr_align, val_center);
+			for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
+			page.print(table_header);
+		}
 
-			static constexpr const char* table_headers[] = { "Result" , "Category", "Primary Skill", "Secondary Skill", "Difficulty", "Time", "Tools", "Components" };
-			page.start_print(_data_table);
-			// actual content
-			{
-				html::tag table_header("tr");
-				table_header.set(attr_align, val_center);
-				for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-				page.print(table_header);
+		{
+			html::tag cell("td");
+			html::tag table_row("tr");
+			table_row.set(attr_align, val_left);
+			table_row.set(attr_valign, val_top);
+			for (decltype(auto) th : table_headers) table_row.append(cell);
+
+			int ub = constructable::constructions.size();
+			while (0 <= --ub) {
+				const constructable* const test = constructable::constructions[ub];
+				table_row[0].append(test->name);
+				table_row[1].append(html::tag::wrap(std::to_string(test->difficulty)));
+				table_row[2].append(to_table(test->stages));
+
+				page.print(table_row);
+				for (decltype(auto) tr : table_row) tr.clear();
 			}
+		}
+	});
+	}
 
-			{
-				html::tag cell("td");
-				html::tag table_row("tr");
-				table_row.set(attr_align, val_left);
-				table_row.set(attr_valign, val_top);
-				for (decltype(auto) th : table_headers) table_row.append(cell);
+	{
+	page_digest inputs;
+	for (const auto book : books) {
+		if (book->type) inputs << book->name << JSON_key(book->type) << book->intel << book->req << book->level;
+	}
 
-				int ub = recipe::recipes.size();
-				while (0 <= --ub) {
-					const recipe* const test = recipe::recipes[ub];
-					if (auto json = JSON_key(test->result)) {
-						table_row[0].append(html::tag::wrap(json));
-						table_row[1].append(html::tag::wrap(crafting_category(test->category)));
-						if (auto primary = JSON_key((test->sk_primary))) table_row[2].append(html::tag::wrap(primary));
-						if (auto secondary = JSON_key((test->sk_secondary))) table_row[3].append(html::tag::wrap(secondary));
-						table_row[4].append(html::tag::wrap(std::to_string(test->difficulty)));
-						table_row[5].append(html::tag::wrap("<nobr>" + test->time_desc() + "</nobr>"));
-						if (!test->tools.empty()) table_row[6].append(html::tag::wrap(to_s(test->tools)));
-						if (!test->components.empty()) table_row[7].append(html::tag::wrap(to_s(test->components)));
-					} else throw std::logic_error("unidentified crafting result");
+	site.emplace_back(HTML_DIR SKILL_PLAN_HTML, "Cataclysm:Z " SKILL_PLAN_LINK_NAME, _head, nav_for(global_nav, "#" SKILL_PLAN_ID "_link", SKILL_PLAN_LINK_NAME), std::move(inputs),
+		[&](html::to_text& page, const html::tag& nav) {
+		page.print(nav);
 
-					page.print(table_row);
-					for (decltype(auto) tr : table_row) tr.clear();
-				}
-			}
-			page.end_print();
+		page.print(html::tag("p","All constructions train carpentry, including the difficulty zero ones.")); // \todo hyperlink to carpentry skill
 
-			page.print(html::tag::wrap("Water may be taken from some terrain types.  Purifying before drinking recommended."));
+		// actual content -- unusual in that we analyze multiple sources here
+		if (!books.empty()) {
+			decltype(books) educational;
+			for (const auto book : books) if (book->type) educational.push_back(book);
+			std::sort(educational.begin(), educational.end(), [](auto x, auto y) {
+				if (auto test = strcmp(JSON_key(x->type), JSON_key(y->type))) return 0 < test;
+				return x->req > y->req;
+			});
 
-			static constexpr const char* water_table_headers[] = { "Terrain", "Chance of food poisoning when drunk", "Severity" };
 			page.start_print(_data_table);
-			// actual content
+			static constexpr const char* table_headers[] = { "Name" , "Skill", "INT", "start at", "educates to"};
 			{
 				html::tag table_header("tr");
 				table_header.set(attr_align, val_center);
-				for (decltype(auto) th : water_table_headers) table_header.append(html::tag("th", th));
+				{
+				html::tag header_cell("th", "Learning from books");
+				header_cell.set("colspan", std::to_string(std::end(table_headers)-std::begin(table_headers)));
+				table_header.append(std::move(header_cell));
+				}
+				page.print(table_header);
+				table_header.clear();
+				for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
 				page.print(table_header);
 			}
-
 			{
 				html::tag cell("td");
 				html::tag table_row("tr");
 				table_row.set(attr_align, val_left);
 				table_row.set(attr_valign, val_top);
-				for (decltype(auto) th : water_table_headers) table_row.append(cell);
+				for (decltype(auto) th : table_headers) table_row.append(cell);
 
-				for (decltype(auto) x : ter_t::water_from_terrain) {
-					if (auto json = JSON_key(x.first)) {
-						table_row[0].append(html::tag::wrap(json));
-						table_row[1].append(html::tag::wrap(std::to_string(x.second.first.numerator()) + " in " + std::to_string(x.second.first.denominator())));
-						table_row[2].append(html::tag::wrap(std::to_string(x.second.second.first) + " ... " + std::to_string(x.second.second.second)));
-					}
-					else throw std::logic_error("unhandled terrain as water source");
+
+				int ub = educational.size();
+				while (0 <= --ub) {
+					const it_book* const book = educational[ub];
+					if (!book->type) continue;
+
+					table_row[0].append(book->name);
+					if (auto sk = JSON_key((book->type))) table_row[1].append(html::tag::wrap(sk));
+					if (book->intel) table_row[2].append(std::to_string((int)(book->intel)));
+					if (book->req) table_row[3].append(std::to_string((int)(book->req)));
+					if (book->level) table_row[4].append(std::to_string((int)(book->level)));
 
 					page.print(table_row);
 					for (decltype(auto) tr : table_row) tr.clear();
 				}
 			}
-
-			while (page.end_print());
+			// page.end_print();
 		}
-
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
+	});
 	}
 
-#undef HTML_TARGET
+	{
+	page_digest inputs;
+	for (decltype(auto) mut : mutation_branch::traits) inputs << mut.name << mut.points << mut.visiblity << mut.ugliness << mut.description;
 
-#define HTML_TARGET HTML_DIR CONSTRUCTION_HTML
+	site.emplace_back(HTML_DIR MUTATIONS_HTML, "Cataclysm:Z " MUTATIONS_LINK_NAME, _head, nav_for(global_nav, "#" MUTATIONS_ID "_link", MUTATIONS_LINK_NAME), std::move(inputs),
+		[&](html::to_text& page, const html::tag& nav) {
+		page.print(nav);
 
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
+		// base display
 		{
-			html::to_text page(out);
-			page.start_print(_html);
-			_title->append(html::tag::wrap("Cataclysm:Z " CONSTRUCTION_LINK_NAME));
-			page.print(_head);
-			_title->clear();
-			page.start_print(_body);
-			{
-				auto revert = swapDOM("#" CONSTRUCTION_ID "_link", global_nav, html::tag("b", CONSTRUCTION_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-			}
-
-			page.print(html::tag::wrap("The (primary) skill for all constructions, is carpentry.")); // \todo hyperlink to carpentry skill
-
-			static constexpr const char* table_headers[] = { "Result" , "Difficulty", "Stages" };
 			page.start_print(_data_table);
-			// actual content
+			static constexpr const char* table_headers[] = { "Name" , "Points", "Visibility", "Ugliness", "Description" };
 			{
 				html::tag table_header("tr");
-				table_header.set(attr_align, val_center);
 				for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
 				page.print(table_header);
 			}
-
 			{
 				html::tag cell("td");
 				html::tag table_row("tr");
@@ -2214,160 +1589,30 @@ int main(int argc, char *argv[])
 				table_row.set(attr_valign, val_top);
 				for (decltype(auto) th : table_headers) table_row.append(cell);
 
-				int ub = constructable::constructions.size();
-				while (0 <= --ub) {
-					const constructable* const test = constructable::constructions[ub];
-					table_row[0].append(test->name);
-					table_row[1].append(html::tag::wrap(std::to_string(test->difficulty)));
-					table_row[2].append(to_table(test->stages));
+				for (decltype(auto) mut : mutation_branch::traits) {
+					table_row[0].append(mut.name);
+					table_row[1].append(std::to_string(mut.points));
+					table_row[2].append(std::to_string(mut.visiblity));
+					table_row[3].append(std::to_string(mut.ugliness));
+					table_row[4].append(mut.description);
 
 					page.print(table_row);
 					for (decltype(auto) tr : table_row) tr.clear();
 				}
 			}
-			while (page.end_print());
-		}
-
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
-	}
-
-#undef HTML_TARGET
-
-#define HTML_TARGET HTML_DIR SKILL_PLAN_HTML
-
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-		{
-			html::to_text page(out);
-			page.start_print(_html);
-			_title->append(html::tag::wrap("Cataclysm:Z " SKILL_PLAN_LINK_NAME));
-			page.print(_head);
-			_title->clear();
-			page.start_print(_body);
-			{
-				auto revert = swapDOM("#" SKILL_PLAN_ID "_link", global_nav, html::tag("b", SKILL_PLAN_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-			}
-
-			page.print(html::tag("p","All constructions train carpentry, including the difficulty zero ones.")); // \todo hyperlink to carpentry skill
-
-			// actual content -- unusual in that we analyze multiple sources here
-			if (!books.empty()) {
-				decltype(books) educational;
-				for (const auto book : books) if (book->type) educational.push_back(book);
-				std::sort(educational.begin(), educational.end(), [](auto x, auto y) {
-					if (auto test = strcmp(JSON_key(x->type), JSON_key(y->type))) return 0 < test;
-					return x->req > y->req;
-				});
-
-				page.start_print(_data_table);
-				static constexpr const char* table_headers[] = { "Name" , "Skill", "INT", "start at", "educates to"};
-				{
-					html::tag table_header("tr");
-					table_header.set(attr_align, val_center);
-					{
-					html::tag header_cell("th", "Learning from books");
-					header_cell.set("colspan", std::to_string(std::end(table_headers)-std::begin(table_headers)));
-					table_header.append(std::move(header_cell));
-					}
-					page.print(table_header);
-					table_header.clear();
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag cell("td");
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					table_row.set(attr_valign, val_top);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-
-
-					int ub = educational.size();
-					while (0 <= --ub) {
-						const it_book* const book = educational[ub];
-						if (!book->type) continue;
-
-						table_row[0].append(book->name);
-						if (auto sk = JSON_key((book->type))) table_row[1].append(html::tag::wrap(sk));
-						if (book->intel) table_row[2].append(std::to_string((int)(book->intel)));
-						if (book->req) table_row[3].append(std::to_string((int)(book->req)));
-						if (book->level) table_row[4].append(std::to_string((int)(book->level)));
-
-						page.print(table_row);
-						for (decltype(auto) tr : table_row) tr.clear();
-					}
-				}
-				// page.end_print();
-			}
-
-			while (page.end_print());
-		}
-
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
-	}
-
-#undef HTML_TARGET
-
-#define HTML_TARGET HTML_DIR MUTATIONS_HTML
-
-	if (FILE* out = fopen(HTML_TARGET ".tmp", "w")) {
-		{
-			html::to_text page(out);
-			page.start_print(_html);
-			_title->append(html::tag::wrap("Cataclysm:Z " MUTATIONS_LINK_NAME));
-			page.print(_head);
-			_title->clear();
-			page.start_print(_body);
-			{
-				auto revert = swapDOM("#" MUTATIONS_ID "_link", global_nav, html::tag("b", MUTATIONS_LINK_NAME));
-				page.print(global_nav);
-				*revert.first = std::move(revert.second);
-			}
-
-			// base display
-			{
-				page.start_print(_data_table);
-				static constexpr const char* table_headers[] = { "Name" , "Points", "Visibility", "Ugliness", "Description" };
-				{
-					html::tag table_header("tr");
-					for (decltype(auto) th : table_headers) table_header.append(html::tag("th", th));
-					page.print(table_header);
-				}
-				{
-					html::tag cell("td");
-					html::tag table_row("tr");
-					table_row.set(attr_align, val_left);
-					table_row.set(attr_valign, val_top);
-					for (decltype(auto) th : table_headers) table_row.append(cell);
-
-					for (decltype(auto) mut : mutation_branch::traits) {
-						table_row[0].append(mut.name);
-						table_row[1].append(std::to_string(mut.points));
-						table_row[2].append(std::to_string(mut.visiblity));
-						table_row[3].append(std::to_string(mut.ugliness));
-						table_row[4].append(mut.description);
-
-						page.print(table_row);
-						for (decltype(auto) tr : table_row) tr.clear();
-					}
-				}
-//				page.end_print();
-			}
-			// \todo dependency graph
-			while (page.end_print());
+//			page.end_print();
 		}
-
-		unlink(HTML_TARGET);
-		rename(HTML_TARGET ".tmp", HTML_TARGET);
+		// \todo dependency graph
+	});
 	}
 
-#undef HTML_TARGET
-
 	*home_revert.first = std::move(home_revert.second);	// statusnav page family handled
 
+	// every page is queued; build the ones whose inputs changed
+	const auto built = rebuild ? std::map<std::string, unsigned long long>() : read_manifest();
+	std::vector<unsigned char> current;
+	auto page_builds = build_pages(site, built, current);
+
 	// \todo monster types page (blocked by items)
 	// for now, just audit
 	for (auto x : mtype::types) {
@@ -2384,6 +1629,10 @@ int main(int argc, char *argv[])
 	if (!JSON::encode(stack0).decode(res)) throw std::logic_error("critical round-trip failure");
 	if (res != stack0) throw std::logic_error("round-trip failure");
 
+	for (decltype(auto) check : page_builds) check.get();	// rethrows any page failure
+	write_manifest(site, current);
+	for (decltype(auto) check : roundtrip_checks) check.get();	// rethrows any round-trip failure
+
 	// route the command line options here
 
 	erase(); // Clear screen
@@ -11,6 +11,67 @@ void submap::set(const tripoint src, int t0, const Badge<mapbuffer>& auth) {
     for (decltype(auto) veh : vehicles) veh->GPSpos.first = src;
 }
 
+// closed-form approximation of what process_fields/process_active_items would have done while we were outside the reality bubble.
+// Radiation and field decay are expected values; item rot is already computed from item::bday so needs no help here.
+void submap::catch_up(int now)
+{
+    const int elapsed = now - turn_last_touched;
+    turn_last_touched = now;
+    if (1 >= elapsed) return;   // was in the reality bubble last turn
+
+    // Radiation slowly decays: one point per 100 turns away; partial periods carry over to the next catch-up
+    rad_pending += elapsed;
+    const int rad_decay = rad_pending / 100;
+    rad_pending %= 100;
+    for (int i = 0; i < SEEX; i++) {
+        for (int j = 0; j < SEEY; j++) {
+            if (0 < rad_decay && 0 < rad[i][j]) rad[i][j] = (rad_decay < rad[i][j]) ? rad[i][j] - rad_decay : 0;
+
+            if (0 < field_count) {
+                field& fd = fld[i][j];
+                if (fd_null != fd.type) {
+                    // process_fields drops one density level per half-life, on average; spreading is not modeled.
+                    // fd.age counts the turns since the last drop, so it carries the partial half-life.
+                    if (const int half_life = field::list[fd.type].halflife; 0 < half_life) {
+                        const int aged = fd.age + elapsed;
+                        const int lost = (0 < aged) ? aged / half_life : 0;
+                        if (lost >= fd.density) remove_field(point(i, j));
+                        else {
+                            fd.density -= lost;
+                            fd.age = aged - lost * half_life;
+                        }
+                    }
+                }
+            }
+
+            if (0 >= active_item_count) continue;
+            auto& stack = itm[i][j];
+            ptrdiff_t n = stack.size();
+            while (0 <= --n) {
+                item& it = stack[n];
+                if (!it.active) continue;
+                if (it.is_artifact()) continue;
+                const auto tool = it.is_tool();
+                if (!tool) {
+                    if (it.has_flag(IF_CHARGE)) it.charges = 0;    // charger guns discharge
+                    it.active = false;
+                    active_item_count--;
+                    continue;
+                }
+                if (0 >= tool->turns_per_charge) continue;
+                const int drain = elapsed / tool->turns_per_charge;
+                if (drain < it.charges) {
+                    it.charges -= drain;
+                    continue;
+                }
+                // ran out while no one was watching.  Expiry can have side effects (lit explosives), so leave the
+                // last charge for process_active_items rather than deciding the outcome here.
+                it.charges = 1;
+            }
+        }
+    }
+}
+
 void submap::add(item&& new_item, const point& dest)
 {
     if (new_item.active) active_item_count++;
@@ -95,6 +156,7 @@ vehicle* submap::add_vehicle(vhtype_id type, point pos, int deg)
     assert(in_bounds(pos));
     vehicles.emplace_back(new vehicle(type, deg));
     vehicles.back()->GPSpos = GPS_loc(GPS, pos);
+    vehicles.back()->layout_changed();
     return vehicles.back().get();
 }
 
@@ -103,6 +165,7 @@ void submap::add(std::shared_ptr<vehicle> veh, const Badge<map>& auth)
     if (veh) {
         veh->GPSpos.first = GPS; // enforce invariant
         vehicles.push_back(veh);
+        veh->layout_changed();
     };
 }
 
@@ -112,6 +175,7 @@ void submap::destroy(vehicle& veh)
     for (decltype(auto) v : vehicles) {
         ++i;
         if (v.get() == &veh) {
+            veh.layout_removed();
             EraseAt(vehicles, i);
             return;
         }
@@ -120,12 +184,10 @@ void submap::destroy(vehicle& veh)
     debuglog("submap::destroy can't find it!");
 }
 
-void submap::veh_gain_moves(proxy_vehicles_t& acc, const Badge<map>& auth)
+void submap::moving_vehicles(proxy_vehicles_t& acc, const Badge<map>& auth) const
 {
     for (decltype(auto) veh : vehicles) {
-        if (0 == veh->velocity) continue;
-        veh->gain_moves(abs(veh->velocity)); // velocity is ability to make more one-tile steps per turn
-        if (0 < veh->moves) acc.push_back(veh);
+        if (0 != veh->velocity) acc.push_back(veh);
     }
 }
 
@@ -138,12 +200,15 @@ void submap::mapgen_swap(submap& dest, const Badge<map>& auth) {
     vehicles.swap(dest.vehicles);
     for (decltype(auto) veh : vehicles) veh->GPSpos.first = GPS;
     for (decltype(auto) veh : dest.vehicles) veh->GPSpos.first = dest.GPS;
+    for (decltype(auto) veh : vehicles) veh->layout_changed();
+    for (decltype(auto) veh : dest.vehicles) veh->layout_changed();
 }
 
 void submap::mapgen_move_cycle(submap* const* cycle, ptrdiff_t ub, const Badge<map>& auth)
 {
     assert(2 <= ub);
     assert(cycle);
+    const ptrdiff_t n = ub;
 
     computer   t_comp(std::move(cycle[--ub]->comp));
     vehicles_t t_vehs(std::move(cycle[ub]->vehicles));
@@ -158,12 +223,16 @@ void submap::mapgen_move_cycle(submap* const* cycle, ptrdiff_t ub, const Badge<m
     cycle[0]->comp     = std::move(t_comp);
     cycle[0]->spawns = std::move(t_spawns);
     cycle[0]->vehicles = std::move(t_vehs);
+    for (ptrdiff_t i = 0; i < n; i++) {
+        for (decltype(auto) veh : cycle[i]->vehicles) veh->layout_changed();
+    }
 }
 
 void submap::mapgen_xform(point(*op)(const point&), const Badge<map>& auth)
 {
     for (decltype(auto) veh : vehicles) veh->GPSpos.second = op(veh->GPSpos.second);
     for (decltype(auto) sp : spawns) sp.pos = op(sp.pos);
+    for (decltype(auto) veh : vehicles) veh->layout_changed();
 }
 
 void submap::post_init(const Badge<defense_game>& auth)
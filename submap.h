@@ -45,6 +45,7 @@ private:
     int active_item_count;
     int field_count;
     int turn_last_touched;
+    int rad_pending;  // turns away from the reality bubble not yet applied to radiation decay
     tripoint GPS;   // cache field -- GPS_loc first coordinate, where we are
 
 public:
@@ -94,6 +95,9 @@ public:
 
     void process_active_items(); // map.cpp; only caller there
     bool process_fields(); // field.cpp
+    // Submaps outside the reality bubble are frozen.  These bring one back up to date, coarsely, when it re-enters.
+    void touch(int now) { turn_last_touched = now; }
+    void catch_up(int now);
 
     void add_spawn(mon_id type, int count, const point& pt, bool friendly, int faction_id, int mission_id, std::string name); // mapgen.cpp
     void add_spawn(const monster& mon); // mapgen.cpp
@@ -110,7 +114,8 @@ public:
     std::optional<std::pair<vehicle*, int>> veh_at(const GPS_loc& loc);
     std::optional<std::pair<const vehicle*, int>> veh_at(const GPS_loc& loc) const;
 
-    void veh_gain_moves(proxy_vehicles_t& acc, const Badge<map>& auth);
+    void moving_vehicles(proxy_vehicles_t& acc, const Badge<map>& auth) const;
+    const vehicles_t& all_vehicles(const Badge<map>& auth) const { return vehicles; }
 
     void post_init(const Badge<defense_game>& auth);
     // mapgen.cpp support
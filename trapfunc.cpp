@@ -396,7 +396,7 @@ void trapfuncm::lava(game *g, monster *z)
 
 void trapfunc::sinkhole(game *g, int x, int y)
 {
-    static std::function<std::optional<point>(point)> dest_ok = [&](point pt) {
+    auto dest_ok = [&](point pt) -> std::optional<point> {
         std::optional<point> ret;
         auto pos = g->u.pos + pt;
         if (0 < g->m.move_cost(pos) && tr_pit != g->m.tr_at(pos)) ret = pos;
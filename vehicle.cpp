@@ -10,6 +10,7 @@
 #include <math.h>
 #include <fstream>
 #include <array>
+#include <algorithm>
 
 void trap_fully_triggered(map& m, const point& pt, const std::vector<item_drop_spec>& drop_these); // trapfunc.cpp
 void trap_fully_triggered(GPS_loc loc, const std::vector<item_drop_spec>& drop_these); // trapfunc.cpp
@@ -264,12 +265,21 @@ void vehicle::remove_part (int p)
 }
 
 
+// order-preserving packing of a part-relative point, for the lookup indexes
+static constexpr int layout_key(int x, int y) { return x * 0x10000 + y; }
+static int layout_key(const point& pt) { return layout_key(pt.x, pt.y); }
+
+static auto layout_range(const std::vector<std::pair<int, int> >& index, int key)
+{
+    static constexpr const auto by_key = [](const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) { return lhs.first < rhs.first; };
+    return std::equal_range(index.begin(), index.end(), std::pair<int, int>(key, 0), by_key);
+}
+
 std::vector<int> vehicle::parts_at_relative (int dx, int dy) const
 {
     std::vector<int> res;
-    for (int i = 0; i < parts.size(); i++)
-        if (parts[i].mount_d.x == dx && parts[i].mount_d.y == dy)
-            res.push_back (i);
+    const auto range = layout_range(by_mount, layout_key(dx, dy));
+    for (auto it = range.first; it != range.second; ++it) res.push_back(it->second);
     return res;
 }
 
@@ -300,11 +310,50 @@ bool vehicle::part_flag(int p, unsigned int f) const
 
 int vehicle::part_at(const point& delta) const
 {
-	for (const auto p : external_parts) {
-		const auto& part = parts[p];
-        if (part.precalc_d[0] == delta) return p;
+    const auto range = layout_range(ext_at, layout_key(delta));
+    return (range.first != range.second) ? range.first->second : -1;
+}
+
+zaimoni::gdi::box<point> vehicle::footprint(int idir) const
+{
+    if (external_parts.empty()) return zaimoni::gdi::box<point>(point(0), point(0));
+    point tl = parts[external_parts.front()].precalc_d[idir];
+    point br = tl;
+    for (const auto p : external_parts) {
+        const point& pt = parts[p].precalc_d[idir];
+        if (pt.x < tl.x) tl.x = pt.x;
+        else if (pt.x > br.x) br.x = pt.x;
+        if (pt.y < tl.y) tl.y = pt.y;
+        else if (pt.y > br.y) br.y = pt.y;
     }
-    return -1;
+    return zaimoni::gdi::box<point>(tl, br);
+}
+
+monster* vehicle_obstacles::mon(const GPS_loc& loc) const
+{
+    const auto g = game::active();
+    for (const auto& h : mons) {
+        if (auto _mon = g->z.get(h); _mon && _mon->GPSpos == loc && !_mon->dead) return _mon;
+    }
+    return nullptr;
+}
+
+player* vehicle_obstacles::survivor(const GPS_loc& loc) const
+{
+    for (const auto p : survivors) if (p->GPSpos == loc) return p;
+    return nullptr;
+}
+
+std::optional<std::pair<vehicle*, int>> vehicle_obstacles::veh_at(const GPS_loc& loc) const
+{
+    for (const auto veh : vehs) {
+        const auto delta = loc - veh->GPSpos;
+        if (const point* const pt = std::get_if<point>(&delta)) {
+            const int part = veh->part_at(*pt);
+            if (0 <= part) return std::pair(veh, part);
+        }
+    }
+    return std::nullopt;
 }
 
 char vehicle::part_sym (int p) const
@@ -420,17 +469,74 @@ void vehicle::print_fuel_indicator(void *w, int y, int x) const
     }
 }
 
-point vehicle::coord_translate (int dir, point reld)
+static point _coord_translate(int dir, point reld)
 {
     tileray tdir (dir);
     tdir.advance (reld.x);
 	return point(tdir.dx() + tdir.ortho_dx(reld.y), tdir.dy() + tdir.ortho_dy(reld.y));
 }
 
+// The controls only turn in 15 degree steps, so there are 24 facings in practice.  Their offsets for every
+// mount point within the vehicle radius are tabulated on first use; anything else takes the tileray path.
+static const point* facing_offsets(int facing)
+{
+    static constexpr const int span = 2 * vehicle::radius + 1;
+    static std::vector<point> cache[360 / 15];
+
+    auto& ret = cache[facing];
+    if (ret.empty()) {
+        ret.reserve(span * span);
+        for (int x = -vehicle::radius; x <= vehicle::radius; x++) {
+            for (int y = -vehicle::radius; y <= vehicle::radius; y++) ret.push_back(_coord_translate(15 * facing, point(x, y)));
+        }
+    }
+    return ret.data();
+}
+
+point vehicle::coord_translate (int dir, point reld)
+{
+    if (0 > dir) dir = 360 - (-dir) % 360;
+    dir %= 360;
+    if (0 == dir % 15 && radius >= abs(reld.x) && radius >= abs(reld.y)) {
+        return facing_offsets(dir / 15)[(reld.x + radius) * (2 * radius + 1) + (reld.y + radius)];
+    }
+    return _coord_translate(dir, reld);
+}
+
 void vehicle::precalc_mounts (int idir, int dir)
 {
     if (idir < 0 || idir > 1) idir = 0;
 	for(auto& part : parts) part.precalc_d[idir] = coord_translate(dir, part.mount_d);
+    if (0 == idir) reindex_parts();
+}
+
+void vehicle::advance_mounts()
+{
+    for (auto& part : parts) part.precalc_d[0] = part.precalc_d[1];
+    reindex_parts();
+}
+
+void vehicle::reindex_parts()
+{
+    by_mount.clear();
+    ext_at.clear();
+    for (int p = 0; p < parts.size(); p++) by_mount.emplace_back(layout_key(parts[p].mount_d), p);
+    for (const int p : external_parts) ext_at.emplace_back(layout_key(parts[p].precalc_d[0]), p);
+    // stable: parts sharing a tile must stay in ascending index order (external part first)
+    static constexpr const auto by_key = [](const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) { return lhs.first < rhs.first; };
+    std::stable_sort(by_mount.begin(), by_mount.end(), by_key);
+    std::stable_sort(ext_at.begin(), ext_at.end(), by_key);
+    layout_changed();
+}
+
+void vehicle::layout_changed()
+{
+    if (const auto g = game::active()) g->m.reindex(*this, Badge<vehicle>());
+}
+
+void vehicle::layout_removed() const
+{
+    if (const auto g = game::active()) g->m.unindex(*this, Badge<vehicle>());
 }
 
 bool vehicle::any_boarded_parts() const
@@ -801,7 +907,8 @@ void vehicle::consume_fuel ()
 
 void vehicle::thrust (int thd)
 {
-    if (velocity == 0) {
+    const bool was_parked = (0 == velocity);
+    if (was_parked) {
         turn_dir = face.dir();
         last_turn = 0;
         move = face;
@@ -877,6 +984,7 @@ void vehicle::thrust (int thd)
         else if (velocity < -max_vel / 4)
             velocity = -max_vel / 4;
     }
+    if (was_parked && 0 != velocity) g->m.vehicle_started(*this);
 }
 
 void vehicle::cruise_thrust (int amount)
@@ -977,7 +1085,7 @@ void vehicle::handbrake(player& u)
     u.moves = 0;
 }
 
-int vehicle::part_collision(int part, GPS_loc dest)
+int vehicle::part_collision(int part, GPS_loc dest, const vehicle_obstacles& near)
 {
     static constexpr const int mass_from_msize[mtype::MS_MAX] = { 15, 40, 80, 200, 800 };
 
@@ -985,12 +1093,12 @@ int vehicle::part_collision(int part, GPS_loc dest)
 
     const bool pl_ctrl = player_in_control(g->u);
     // automatic collision w/NPCs until they can board \todo fix
-    player* ph = g->survivor(dest);
-    monster* const z = g->mon(dest);
-    if (ph->in_vehicle) ph = nullptr;
-    const auto v = dest.veh_at();
+    player* ph = near.survivor(dest);
+    monster* const z = near.mon(dest);
+    if (ph && ph->in_vehicle) ph = nullptr;
+    const auto v = near.veh_at(dest);
     vehicle* const oveh = v ? v->first : nullptr; // backward compatibility
-    const bool veh_collision = oveh && oveh->GPSpos != GPSpos;
+    const bool veh_collision = oveh && oveh != this;
     bool body_collision = ph || z;
 
     // 0 - nothing, 1 - monster/player/npc, 2 - vehicle,
@@ -8,11 +8,14 @@
 #include "mobile.h"
 #include "enums.h"
 #include "rational.hpp"
+#include "slot_map.hpp"
+#include "Zaimoni.STL/GDI/box.hpp"
 #include <vector>
 #include <string>
 #include <iosfwd>
 
 class map;
+class monster;
 class player;
 class game;
 
@@ -48,6 +51,19 @@ struct vehicle_part
     player* get_passenger(GPS_loc origin) const;
 };
 
+// Broadphase for one map::vehmove step: whatever the moving vehicle's footprint could reach.  part_collision
+// then tests these candidates per part, rather than rescanning the monster list and 3x3 submaps per part.
+struct vehicle_obstacles
+{
+    std::vector<slot_map<monster>::handle> mons;   // into game::z; stale once the monster is erased
+    std::vector<player*> survivors;
+    std::vector<vehicle*> vehs;
+
+    monster* mon(const GPS_loc& loc) const;
+    player* survivor(const GPS_loc& loc) const;
+    std::optional<std::pair<vehicle*, int>> veh_at(const GPS_loc& loc) const;
+};
+
 // Facts you need to know about implementation:
 // - Vehicles belong to map. There's std::vector<vehicle>
 //   for each submap in grid. When requesting a reference
@@ -196,6 +212,9 @@ public:
 // Seek a vehicle part which obstructs tile with given coords relative to vehicle position
     int part_at(const point& delta) const;
 
+// bounding box of external parts, relative to vehicle position, for precalc_d[idir]
+    zaimoni::gdi::box<point> footprint(int idir) const;
+
 // get symbol for map
     char part_sym (int p) const;
 
@@ -211,6 +230,11 @@ public:
 
 // Precalculate mount points for (idir=0) - current direction or (idir=1) - next turn direction
     void precalc_mounts (int idir, int dir);
+// Commit the precalc_d[1] layout computed for the next move as the current one
+    void advance_mounts();
+// Tell the game's map that our tiles moved (position, facing or parts), or that we are leaving our submap
+    void layout_changed();
+    void layout_removed() const;
 
 // get a list of part indices where is a passenger inside
     std::vector<int> boarded_parts() const;
@@ -287,7 +311,7 @@ public:
 
 // handle given part collision with vehicle, monster/NPC/player or terrain obstacle
 // return impulse (damage) applied on vehicle for that collision
-    int part_collision(int part, GPS_loc dest);
+    int part_collision(int part, GPS_loc dest, const vehicle_obstacles& near);
 
 // Process the trap beneath
     void handle_trap(GPS_loc pt, int part);
@@ -363,6 +387,11 @@ public:
     int last_turn;      // amount of last turning (for calculate skidding due to handbrake)
     int turret_mode;    // turret firing mode: 0 = off, 1 = burst fire	; leave as int in case we want true autofire
 private:
+    // lookup indexes, rebuilt by precalc_mounts(0, ...): (packed point, part index) sorted by point
+    std::vector<std::pair<int, int> > by_mount;  // all parts, keyed by mount_d
+    std::vector<std::pair<int, int> > ext_at;    // external parts, keyed by precalc_d[0]
+    void reindex_parts();
+
     void _set_screenpos() override {}
     bool handle_knockback_into_impassable(const GPS_loc& dest) override { return false; } // stub
 
@@ -33,6 +33,12 @@ struct weather_effect	// NPCs not really affected
 	static void flurry(game *) {};
 	static void snow(game *) {};
 	static void snowstorm(game *) {};
+
+private:
+	// one outdoors mask per turn's weather, shared by the composite effects
+	static bool outside(const game* g, const std::vector<bool>& mask, const point& pt);
+	static void rain(game *g, const std::vector<bool>& mask, int fire_age, int morale_min);
+	static void thunder(game *g, const std::vector<bool>& mask);
 };
 
 /* Name, color in UI, {seasonal temperatures}, ranged penalty, sight penalty,
@@ -93,47 +99,45 @@ void weather_effect::glare(game *g)
  if (g->is_in_sunlight(g->u.GPSpos)) g->u.infect(DI_GLARE, bp_eyes, 1, 2);
 }
 
-void weather_effect::wet(game *g)
+bool weather_effect::outside(const game* g, const std::vector<bool>& mask, const point& pt)
 {
- if (!g->u.is_wearing(itm_coat_rain) && !g->u.has_trait(PF_FEATHERS) && g->u.GPSpos.is_outside() && one_in(2))
-  g->u.add_morale(MORALE_WET, -1, -30);
-// Put out fires and reduce scent
- static auto extinguish = [&](const point& delta) {
-	 auto dest = g->u.GPSpos + delta;
-	 auto dest_pt = g->u.pos + delta;
-	 if (dest.is_outside()) {
-		 auto& fd = dest.field_at();
-		 if (fd.type == fd_fire) fd.age += 15;
-		 auto& sc = g->scent(dest_pt);
-		 if (sc > 0) sc--;
-	 }
- };
+ const int span = SEE * MAPSIZE;
+ return 0 <= pt.x && span > pt.x && 0 <= pt.y && span > pt.y && mask[pt.x + pt.y * span];
+}
 
- forall_do_inclusive(within_rldist<2 * SEE>, extinguish);
+// Put out fires and reduce scent, everywhere in the reality bubble the rain reaches.
+// Light rain (morale floor -30) only dampens spirits half the time.
+void weather_effect::rain(game *g, const std::vector<bool>& mask, int fire_age, int morale_min)
+{
+ if (!g->u.is_wearing(itm_coat_rain) && !g->u.has_trait(PF_FEATHERS) && outside(g, mask, g->u.pos) && (-30 > morale_min || one_in(2)))
+  g->u.add_morale(MORALE_WET, -1, morale_min);
+
+ const int span = SEE * MAPSIZE;
+ point pt;
+ for (pt.y = 0; pt.y < span; pt.y++) {
+  for (pt.x = 0; pt.x < span; pt.x++) {
+   if (!mask[pt.x + pt.y * span]) continue;
+   auto& fd = g->m.field_at(pt);
+   if (fd.type == fd_fire) fd.age += fire_age;
+   auto& sc = g->scent(pt);
+   if (sc > 0) sc--;
+  }
+ }
 }
 
-void weather_effect::very_wet(game *g)
+void weather_effect::wet(game *g)
 {
- if (!g->u.is_wearing(itm_coat_rain) && !g->u.has_trait(PF_FEATHERS) && g->u.GPSpos.is_outside())
-  g->u.add_morale(MORALE_WET, -1, -60);
-// Put out fires and reduce scent
- static auto extinguish = [&](const point& delta) {
-	 auto dest = g->u.GPSpos + delta;
-	 auto dest_pt = g->u.pos + delta;
-	 if (dest.is_outside()) {
-		 auto& fd = dest.field_at();
-		 if (fd.type == fd_fire) fd.age += 45;
-		 auto& sc = g->scent(dest_pt);
-		 if (sc > 0) sc--;
-	 }
- };
+ rain(g, g->m.outside_mask(), 15, -30);
+}
 
- forall_do_inclusive(within_rldist<2 * SEE>, extinguish);
+void weather_effect::very_wet(game *g)
+{
+ rain(g, g->m.outside_mask(), 45, -60);
 }
 
-void weather_effect::thunder(game *g)
+void weather_effect::thunder(game *g, const std::vector<bool>& mask)
 {
- very_wet(g);
+ rain(g, mask, 45, -60);
  if (one_in(THUNDER_CHANCE)) {
   if (g->lev.z >= 0)
    messages.add("You hear a distant rumble of thunder.");
@@ -142,28 +146,35 @@ void weather_effect::thunder(game *g)
  }
 }
 
+void weather_effect::thunder(game *g)
+{
+ thunder(g, g->m.outside_mask());
+}
+
 void weather_effect::lightning(game *g)
 {
- thunder(g);
+ const auto mask = g->m.outside_mask();
+ thunder(g, mask);
  if (one_in(LIGHTNING_CHANCE)) {
-	 static auto ok = [&](point delta) {
-		 const auto dest = g->u.GPSpos + delta;
-		 if (0 == dest.move_cost() && dest.is_outside()) return std::optional<GPS_loc>(dest);
-		 return std::optional<GPS_loc>();
+	 std::vector<point> strike;
+	 auto ok = [&](const point& delta) {
+		 const point dest = g->u.pos + delta;
+		 if (outside(g, mask, dest) && 0 == g->m.move_cost(dest)) strike.push_back(dest);
 	 };
 
-	 const auto strike = grep(within_rldist<2 * SEE>, std::function(ok));
+	 forall_do_inclusive(within_rldist<2 * SEE>, ok);
 	 if (auto ub = strike.size()) {
 		 messages.add("Lightning strikes nearby!");
-		 strike[rng(0, ub - 1)].explosion(10, 0, one_in(4));
+		 g->explosion(strike[rng(0, ub - 1)], 10, 0, one_in(4));
 	 }
  }
 }
 
 void weather_effect::light_acid(game *g)
 {
- wet(g);
- if (int(messages.turn) % 10 == 0 && g->u.GPSpos.is_outside())
+ const auto mask = g->m.outside_mask();
+ rain(g, mask, 15, -30);
+ if (int(messages.turn) % 10 == 0 && outside(g, mask, g->u.pos))
   messages.add("The acid rain stings, but is harmless for now...");
 }
 
@@ -177,15 +188,9 @@ void weather_effect::light_acid(game *g)
 // to omit that requirement.)
 void weather_effect::acid(game *g)
 {
-	static auto make_puddle = [&](const point& delta) {
-		auto dest = g->u.GPSpos + delta;
-		auto terrain = dest.ter();
-		if (!is<diggable>(terrain) && !is<noitem>(terrain) &&
-			0 < dest.move_cost() && dest.is_outside() && one_in(MINUTES(40)))
-			dest.add(field(fd_acid, 1));
-	};
+	const auto mask = g->m.outside_mask();
 
-	static std::function<void(player&)> corrode_player = [](player& u) {
+	auto corrode_player = [](player& u) {
 		const auto g = game::active();
 		u.subjective_message("The acid rain burns!");
 		if (one_in(6))
@@ -209,12 +214,22 @@ void weather_effect::acid(game *g)
  g->forall_do(corrode_player);
 
  // reality-simulator wants damage to trees, if not non-living map objects, here
- if (g->lev.z >= 0) forall_do_inclusive(within_rldist<2*SEE>, make_puddle);
+ // (the mask is empty below ground)
+ const int span = SEE * MAPSIZE;
+ point pt;
+ for (pt.y = 0; pt.y < span; pt.y++) {
+	 for (pt.x = 0; pt.x < span; pt.x++) {
+		 if (!mask[pt.x + pt.y * span]) continue;
+		 const auto terrain = g->m.ter(pt);
+		 if (!is<diggable>(terrain) && !is<noitem>(terrain) && 0 < g->m.move_cost(pt) && one_in(MINUTES(40)))
+			 g->m.add_field(g, pt.x, pt.y, fd_acid, 1);
+	 }
+ }
 
- static auto corrode_monster = [](monster& z) {
-	 if (z.GPSpos.is_outside() && !z.has_flag(MF_ACIDPROOF)) z.hurt(1);
+ auto corrode_monster = [&](monster& z) {
+	 if (outside(g, mask, z.pos) && !z.has_flag(MF_ACIDPROOF)) z.hurt(1);
  };
 
  g->forall_do(corrode_monster);
- very_wet(g);
+ rain(g, mask, 45, -60);
 }